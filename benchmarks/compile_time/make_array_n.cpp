@@ -0,0 +1,43 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+/*
+ * A translation unit building BENCH_N element tables with make_array, compiled (never linked)
+ * by measure.cmake once per table size to see what make_array costs the compiler.
+ */
+
+#include <cstddef>
+
+#include "sst/cpputils/constructors.h"
+
+#ifndef BENCH_N
+#define BENCH_N 4096
+#endif
+
+struct NotDefaultConstructible
+{
+    float value;
+    NotDefaultConstructible(size_t idx, float scale) : value(idx * scale) {}
+};
+
+float lookup(size_t i)
+{
+    static constexpr auto ramp =
+        sst::cpputils::make_array_lambda<float, BENCH_N>([](auto idx) { return idx * 0.5f; });
+    static const auto scaled =
+        sst::cpputils::make_array_bind_first_index<NotDefaultConstructible, BENCH_N>(0.25f);
+    return ramp[i] + scaled[i].value;
+}
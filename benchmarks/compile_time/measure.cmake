@@ -0,0 +1,76 @@
+# Measures the cost of compiling make_array_n.cpp for a range of table sizes, reporting
+# wall time and, where GNU time or BSD time -l is available, the compiler's peak memory.
+#
+# Each size is compiled with the default strategy and, up to PACK_COMPARE_MAX, again with
+# SST_CPPUTILS_MAKE_ARRAY_PACK_LIMIT raised so the whole table goes through the single index
+# pack, for comparison. Run through the sst-cpputils-compile-bench target, or directly as
+#
+#   cmake -DCXX=g++ -DINCLUDE_DIR=include -DSOURCE=benchmarks/compile_time/make_array_n.cpp
+#         -DWORK_DIR=/tmp/cb -P benchmarks/compile_time/measure.cmake
+#
+# It drives the compiler with GCC / Clang style flags.
+
+if (NOT SIZES)
+    set(SIZES 256 1024 4096 16384 65536)
+endif ()
+if (NOT PACK_COMPARE_MAX)
+    set(PACK_COMPARE_MAX 4096)
+endif ()
+if (NOT CXX_FLAGS)
+    set(CXX_FLAGS -O2)
+endif ()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+find_program(TIME_EXE NAMES time PATHS /usr/bin /usr/local/bin NO_DEFAULT_PATH)
+set(time_style "")
+if (TIME_EXE)
+    execute_process(COMMAND ${TIME_EXE} --version RESULT_VARIABLE rv OUTPUT_QUIET ERROR_QUIET)
+    if (rv EQUAL 0)
+        set(time_style gnu)
+    elseif (APPLE)
+        set(time_style bsd)
+    endif ()
+endif ()
+
+function(measure n strategy)
+    set(defs -DBENCH_N=${n})
+    if (strategy STREQUAL "pack")
+        math(EXPR limit "${n} + 1")
+        list(APPEND defs -DSST_CPPUTILS_MAKE_ARRAY_PACK_LIMIT=${limit})
+    endif ()
+
+    set(cmd ${CXX} -std=c++17 ${CXX_FLAGS} -I${INCLUDE_DIR} ${defs} -c ${SOURCE}
+            -o ${WORK_DIR}/make_array_${n}_${strategy}.o)
+    if (time_style STREQUAL "gnu")
+        set(cmd ${TIME_EXE} -f "peak-kb %M" ${cmd})
+    elseif (time_style STREQUAL "bsd")
+        set(cmd ${TIME_EXE} -l ${cmd})
+    endif ()
+
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND ${cmd} RESULT_VARIABLE rv OUTPUT_VARIABLE out ERROR_VARIABLE err)
+    string(TIMESTAMP end "%s%f")
+    math(EXPR ms "(${end} - ${start}) / 1000")
+
+    set(peak "n/a")
+    if (err MATCHES "peak-kb ([0-9]+)")
+        set(peak "${CMAKE_MATCH_1} KB")
+    elseif (err MATCHES "([0-9]+) +maximum resident set size")
+        math(EXPR kb "${CMAKE_MATCH_1} / 1024")
+        set(peak "${kb} KB")
+    endif ()
+    set(status "")
+    if (NOT rv EQUAL 0)
+        set(status "  FAILED")
+    endif ()
+
+    message("make_array N=${n}\t${strategy}\t${ms} ms\tpeak ${peak}${status}")
+endfunction()
+
+foreach (n ${SIZES})
+    measure(${n} default)
+    if (n LESS_EQUAL PACK_COMPARE_MAX)
+        measure(${n} pack)
+    endif ()
+endforeach ()
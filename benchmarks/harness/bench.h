@@ -0,0 +1,312 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_BENCHMARKS_HARNESS_BENCH_H
+#define INCLUDE_SST_CPPUTILS_BENCHMARKS_HARNESS_BENCH_H
+
+/*
+ * A small in-tree micro-benchmark harness, so the sst-cpputils-bench target needs nothing
+ * fetched. Benchmarks are registered in groups, one translation unit per library header:
+ *
+ * ```
+ * SST_BENCH_GROUP(radix_sort)
+ * {
+ *     std::vector<uint32_t> keys = randomKeys(65536), work;
+ *     bench.run_with_setup("std::sort", [&] { work = keys; },
+ *                          [&] { std::sort(work.begin(), work.end()); }, keys.size());
+ * }
+ * ```
+ *
+ * Each run() calibrates how many calls make up one sample of at least --sample-ms, warms
+ * up for --warmup-ms, then takes --reps samples and reports the min, median, mean and
+ * standard deviation of the time per call (and of the TSC ticks per call on x86) as a table
+ * and, with --json, as a JSON document. The process is pinned to one CPU unless --cpu -1 is
+ * given. See bench_main.cpp for the options.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SST_BENCH_NOINLINE __declspec(noinline)
+#else
+#define SST_BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace sst
+{
+namespace cpputils
+{
+namespace bench
+{
+#ifndef DOXYGEN
+namespace detail
+{
+inline const void *volatile sink{nullptr};
+} // namespace detail
+#endif
+
+// Make the compiler assume value is read, so the computation producing it is not removed
+template <typename T> inline void do_not_optimize(T &&value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    detail::sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// Make the compiler assume all memory is read and written here
+inline void clobber_memory()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : : "memory");
+#endif
+}
+
+/*
+ * steady_clock nanoseconds, plus the time stamp counter on x86. The TSC ticks at a constant
+ * reference rate rather than the core clock, so treat its counts as a finer grained clock,
+ * not as core cycles.
+ */
+struct clock
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    static constexpr bool hasTicks{true};
+    static uint64_t ticks() { return __rdtsc(); }
+#elif defined(__x86_64__) || defined(__i386__)
+    static constexpr bool hasTicks{true};
+    static uint64_t ticks() { return __rdtsc(); }
+#else
+    static constexpr bool hasTicks{false};
+    static uint64_t ticks() { return 0; }
+#endif
+    static uint64_t ns()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+};
+
+struct options
+{
+    std::string filter;
+    size_t repetitions{15};
+    double warmupMs{20};
+    double sampleMs{2};
+    int cpu{-2}; // -2 pins to the CPU main starts on, -1 does not pin
+    bool useTicks{clock::hasTicks};
+    bool list{false};
+    std::string jsonPath;
+};
+
+struct summary
+{
+    double min{0}, median{0}, mean{0}, stddev{0};
+};
+
+struct result
+{
+    std::string group, name;
+    size_t callsPerSample{0};
+    size_t samples{0};
+    double itemsPerCall{1};
+    summary ns;
+    bool hasTicks{false};
+    summary ticks;
+};
+
+summary summarize(std::vector<double> values);
+
+class runner
+{
+  public:
+    explicit runner(const options &o) : opts(o) {}
+
+    void begin_group(const std::string &g) { group = g; }
+
+    /*
+     * Time fn(), which should do one unit of work; a non void result is passed through
+     * do_not_optimize. itemsPerCall is how many elements one call processes, for the
+     * throughput column.
+     */
+    template <typename F> void run(const std::string &name, F &&fn, double itemsPerCall = 1)
+    {
+        if (!selected(name))
+            return;
+        auto batch = [&](size_t calls, uint64_t &ns, uint64_t &ticks) {
+            auto t0 = clock::ticks();
+            auto n0 = clock::ns();
+            for (size_t i = 0; i < calls; ++i)
+                invoke(fn);
+            auto n1 = clock::ns();
+            auto t1 = clock::ticks();
+            ns = n1 - n0;
+            ticks = t1 - t0;
+        };
+        measure(name, itemsPerCall, batch);
+    }
+
+    /*
+     * As run, but calls setup() before every call of fn() without timing it, for work which
+     * consumes its input, such as sorting or erasing. Each call is timed on its own, so fn
+     * should take well over the clock's overhead, a microsecond or more.
+     */
+    template <typename S, typename F>
+    void run_with_setup(const std::string &name, S &&setup, F &&fn, double itemsPerCall = 1)
+    {
+        if (!selected(name))
+            return;
+        auto batch = [&](size_t calls, uint64_t &ns, uint64_t &ticks) {
+            ns = 0;
+            ticks = 0;
+            for (size_t i = 0; i < calls; ++i)
+            {
+                setup();
+                clobber_memory();
+                auto t0 = clock::ticks();
+                auto n0 = clock::ns();
+                invoke(fn);
+                auto n1 = clock::ns();
+                auto t1 = clock::ticks();
+                ns += n1 - n0;
+                ticks += t1 - t0;
+            }
+        };
+        measure(name, itemsPerCall, batch);
+    }
+
+    const std::vector<result> &results() const { return res; }
+
+  private:
+    template <typename F> static void invoke(F &fn)
+    {
+        if constexpr (std::is_void_v<decltype(fn())>)
+        {
+            fn();
+            clobber_memory();
+        }
+        else
+        {
+            do_not_optimize(fn());
+        }
+    }
+
+    bool selected(const std::string &name) const;
+
+    template <typename Batch> void measure(const std::string &name, double items, Batch &batch)
+    {
+        const auto sampleNs = (uint64_t)(opts.sampleMs * 1e6);
+        uint64_t ns{0}, ticks{0};
+
+        // Grow the calls per sample until one sample takes sampleNs
+        size_t calls{1};
+        for (;;)
+        {
+            batch(calls, ns, ticks);
+            if (ns >= sampleNs || calls >= (size_t(1) << 30))
+                break;
+            auto grow = ns == 0 ? 10.0 : 1.2 * (double)sampleNs / (double)ns;
+            grow = grow < 2 ? 2 : (grow > 10 ? 10 : grow);
+            calls = (size_t)((double)calls * grow);
+        }
+
+        const auto warmupNs = (uint64_t)(opts.warmupMs * 1e6);
+        for (uint64_t spent = 0; spent < warmupNs; spent += ns)
+            batch(calls, ns, ticks);
+
+        std::vector<double> perCallNs, perCallTicks;
+        for (size_t r = 0; r < opts.repetitions; ++r)
+        {
+            batch(calls, ns, ticks);
+            perCallNs.push_back((double)ns / (double)calls);
+            perCallTicks.push_back((double)ticks / (double)calls);
+        }
+
+        result rs;
+        rs.group = group;
+        rs.name = name;
+        rs.callsPerSample = calls;
+        rs.samples = opts.repetitions;
+        rs.itemsPerCall = items;
+        rs.ns = summarize(std::move(perCallNs));
+        rs.hasTicks = opts.useTicks && clock::hasTicks;
+        if (rs.hasTicks)
+            rs.ticks = summarize(std::move(perCallTicks));
+        report(rs);
+        res.push_back(std::move(rs));
+    }
+
+    void report(const result &r) const;
+
+    options opts;
+    std::string group;
+    std::vector<result> res;
+};
+
+/*
+ * Pinning the process to one CPU also pins every thread it starts. Hold one of these while
+ * constructing anything which starts threads meant to spread out, such as a ThreadPool.
+ */
+class scoped_unpin
+{
+  public:
+    scoped_unpin();
+    ~scoped_unpin();
+    scoped_unpin(const scoped_unpin &) = delete;
+    scoped_unpin &operator=(const scoped_unpin &) = delete;
+};
+
+using group_fn = void (*)(runner &);
+
+struct registrar
+{
+    registrar(const char *name, group_fn fn);
+};
+
+struct registered_group
+{
+    const char *name;
+    group_fn fn;
+};
+std::vector<registered_group> &registry();
+
+} // namespace bench
+} // namespace cpputils
+} // namespace sst
+
+#define SST_BENCH_GROUP(name)                                                                      \
+    static void sstBenchGroup_##name(::sst::cpputils::bench::runner &);                            \
+    static ::sst::cpputils::bench::registrar sstBenchRegistrar_##name(#name,                       \
+                                                                      &sstBenchGroup_##name);      \
+    static void sstBenchGroup_##name(::sst::cpputils::bench::runner &bench)
+
+#endif // INCLUDE_SST_CPPUTILS_BENCHMARKS_HARNESS_BENCH_H
@@ -0,0 +1,382 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+/*
+ * The harness implementation and main() of sst-cpputils-bench.
+ *
+ *   sst-cpputils-bench [--filter text] [--reps n] [--warmup-ms ms] [--sample-ms ms]
+ *                      [--cpu n] [--no-ticks] [--json path|-] [--list]
+ *
+ * --filter runs only the benchmarks whose "group/name" contains the text. --list prints the
+ * group names matching the filter as "group/" without running any group, so it has no setup
+ * cost or side effects; --filter group/ then runs one group. --cpu pins to a given CPU, or
+ * with -1 not at all; by default the process stays on the CPU it started on.
+ * --json writes the results as JSON to a file, or with - to stdout, moving the table to
+ * stderr.
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "sst/cpputils/detail/platform.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace sst
+{
+namespace cpputils
+{
+namespace bench
+{
+std::vector<registered_group> &registry()
+{
+    static std::vector<registered_group> groups;
+    return groups;
+}
+
+registrar::registrar(const char *name, group_fn fn) { registry().push_back({name, fn}); }
+
+summary summarize(std::vector<double> values)
+{
+    summary s;
+    if (values.empty())
+        return s;
+    std::sort(values.begin(), values.end());
+    auto n = values.size();
+    s.min = values.front();
+    s.median = n % 2 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+    double sum{0};
+    for (auto v : values)
+        sum += v;
+    s.mean = sum / (double)n;
+    double sq{0};
+    for (auto v : values)
+        sq += (v - s.mean) * (v - s.mean);
+    s.stddev = n > 1 ? std::sqrt(sq / (double)(n - 1)) : 0;
+    return s;
+}
+
+#ifndef DOXYGEN
+namespace detail
+{
+#if defined(__linux__)
+static cpu_set_t originalMask;
+static int pinnedCpu{-1};
+
+static bool pinTo(int cpu)
+{
+    if (sched_getaffinity(0, sizeof(originalMask), &originalMask) != 0)
+        return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        return false;
+    pinnedCpu = cpu;
+    return true;
+}
+static int currentCpu() { return sched_getcpu(); }
+#elif defined(_WIN32)
+static DWORD_PTR originalMask{0};
+static int pinnedCpu{-1};
+
+static bool pinTo(int cpu)
+{
+    originalMask = SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+    if (originalMask == 0)
+        return false;
+    pinnedCpu = cpu;
+    return true;
+}
+static int currentCpu() { return (int)GetCurrentProcessorNumber(); }
+#else
+// macOS, for one, has no way to bind a thread to a CPU
+static int pinnedCpu{-1};
+static bool pinTo(int) { return false; }
+static int currentCpu() { return -1; }
+#endif
+
+static std::string jsonEscape(const std::string &s)
+{
+    std::string r;
+    for (auto c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            r += '\\';
+            r += c;
+        }
+        else if ((unsigned char)c < 0x20)
+        {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)c);
+            r += buf;
+        }
+        else
+        {
+            r += c;
+        }
+    }
+    return r;
+}
+
+static std::string compilerName()
+{
+    std::ostringstream oss;
+#if defined(__clang__)
+    oss << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__GNUC__)
+    oss << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+    oss << "msvc " << _MSC_VER;
+#else
+    oss << "unknown";
+#endif
+    return oss.str();
+}
+
+static std::string simdName()
+{
+    std::string r;
+#if SST_CPPUTILS_SIMD_AVX2
+    r = "avx2";
+#elif SST_CPPUTILS_SIMD_SSE2
+    r = "sse2";
+#elif SST_CPPUTILS_SIMD_NEON64
+    r = "neon64";
+#elif SST_CPPUTILS_SIMD_NEON
+    r = "neon";
+#else
+    r = "none";
+#endif
+    return r;
+}
+
+static void writeSummary(std::ostream &os, const char *key, const summary &s)
+{
+    os << "\"" << key << "\": {\"min\": " << s.min << ", \"median\": " << s.median
+       << ", \"mean\": " << s.mean << ", \"stddev\": " << s.stddev << "}";
+}
+
+static void writeJson(std::ostream &os, const std::vector<result> &results, const options &o,
+                      int pinnedCpu)
+{
+    char date[32]{};
+    auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    os.precision(6);
+    os << "{\n  \"context\": {\n";
+    os << "    \"date\": \"" << date << "\",\n";
+    os << "    \"compiler\": \"" << jsonEscape(compilerName()) << "\",\n";
+#if defined(NDEBUG)
+    os << "    \"assertions\": false,\n";
+#else
+    os << "    \"assertions\": true,\n";
+#endif
+    os << "    \"simd\": \"" << simdName() << "\",\n";
+    os << "    \"pinned_cpu\": " << pinnedCpu << ",\n";
+    os << "    \"repetitions\": " << o.repetitions << ",\n";
+    os << "    \"warmup_ms\": " << o.warmupMs << ",\n";
+    os << "    \"sample_ms\": " << o.sampleMs << ",\n";
+    os << "    \"ticks\": \"" << (o.useTicks && clock::hasTicks ? "tsc" : "none") << "\"\n";
+    os << "  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto &r = results[i];
+        os << (i ? ",\n" : "\n") << "    {\"group\": \"" << jsonEscape(r.group)
+           << "\", \"name\": \"" << jsonEscape(r.name)
+           << "\", \"calls_per_sample\": " << r.callsPerSample
+           << ", \"samples\": " << r.samples << ", \"items_per_call\": " << r.itemsPerCall
+           << ",\n     ";
+        writeSummary(os, "ns_per_call", r.ns);
+        if (r.hasTicks)
+        {
+            os << ",\n     ";
+            writeSummary(os, "ticks_per_call", r.ticks);
+        }
+        if (r.ns.median > 0)
+            os << ",\n     \"items_per_second\": " << r.itemsPerCall * 1e9 / r.ns.median;
+        os << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+static void usage()
+{
+    std::cerr << "usage: sst-cpputils-bench [--filter text] [--reps n] [--warmup-ms ms]\n"
+                 "                          [--sample-ms ms] [--cpu n|-1] [--no-ticks]\n"
+                 "                          [--json path|-] [--list]\n";
+}
+} // namespace detail
+#endif
+
+scoped_unpin::scoped_unpin()
+{
+#if defined(__linux__)
+    if (detail::pinnedCpu >= 0)
+        sched_setaffinity(0, sizeof(detail::originalMask), &detail::originalMask);
+#elif defined(_WIN32)
+    if (detail::pinnedCpu >= 0)
+        SetThreadAffinityMask(GetCurrentThread(), detail::originalMask);
+#endif
+}
+
+scoped_unpin::~scoped_unpin()
+{
+    if (detail::pinnedCpu >= 0)
+        detail::pinTo(detail::pinnedCpu);
+}
+
+bool runner::selected(const std::string &name) const
+{
+    auto full = group + "/" + name;
+    return opts.filter.empty() || full.find(opts.filter) != std::string::npos;
+}
+
+void runner::report(const result &r) const
+{
+    auto *out = opts.jsonPath == "-" ? stderr : stdout;
+    auto full = r.group + "/" + r.name;
+    auto spread = r.ns.mean > 0 ? 100.0 * r.ns.stddev / r.ns.mean : 0.0;
+    auto rate = r.ns.median > 0 ? r.itemsPerCall * 1e9 / r.ns.median : 0.0;
+    std::fprintf(out, "%-52s %12.2f %12.2f %6.1f%%", full.c_str(), r.ns.median, r.ns.min,
+                 spread);
+    if (r.hasTicks)
+        std::fprintf(out, " %12.1f", r.ticks.median);
+    else
+        std::fprintf(out, " %12s", "-");
+    std::fprintf(out, " %12.4g\n", rate);
+    std::fflush(out);
+}
+
+} // namespace bench
+} // namespace cpputils
+} // namespace sst
+
+int main(int argc, char **argv)
+{
+    namespace sb = sst::cpputils::bench;
+    sb::options opts;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string a = argv[i];
+        auto next = [&]() -> const char * {
+            if (i + 1 >= argc)
+            {
+                sb::detail::usage();
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--filter")
+            opts.filter = next();
+        else if (a == "--reps")
+            opts.repetitions = (size_t)std::max(1, std::atoi(next()));
+        else if (a == "--warmup-ms")
+            opts.warmupMs = std::atof(next());
+        else if (a == "--sample-ms")
+            opts.sampleMs = std::max(0.01, std::atof(next()));
+        else if (a == "--cpu")
+            opts.cpu = std::atoi(next());
+        else if (a == "--no-ticks")
+            opts.useTicks = false;
+        else if (a == "--json")
+            opts.jsonPath = next();
+        else if (a == "--list")
+            opts.list = true;
+        else
+        {
+            sb::detail::usage();
+            return a == "--help" || a == "-h" ? 0 : 2;
+        }
+    }
+
+    if (opts.cpu != -1 && !opts.list)
+    {
+        auto cpu = opts.cpu == -2 ? sb::detail::currentCpu() : opts.cpu;
+        if (cpu < 0 || !sb::detail::pinTo(cpu))
+            std::cerr << "Could not pin to a CPU; timings will be noisier\n";
+    }
+
+    auto groups = sb::registry();
+    std::sort(groups.begin(), groups.end(),
+              [](const auto &a, const auto &b) { return std::strcmp(a.name, b.name) < 0; });
+
+    // Benchmark names only exist once a group body runs its setup, so list the groups
+    if (opts.list)
+    {
+        for (const auto &g : groups)
+        {
+            auto prefix = std::string(g.name) + "/";
+            if (opts.filter.empty() || prefix.find(opts.filter) != std::string::npos)
+                std::cout << prefix << "\n";
+        }
+        return 0;
+    }
+
+    sb::runner run(opts);
+    auto *out = opts.jsonPath == "-" ? stderr : stdout;
+    std::fprintf(out, "%-52s %12s %12s %7s %12s %12s\n", "benchmark", "median ns", "min ns",
+                 "stddev", "median tsc", "items/s");
+    // A filter with a / names its group, so other groups need not even run their setup
+    auto slash = opts.filter.find('/');
+    auto groupPart = opts.filter.substr(0, slash == std::string::npos ? 0 : slash);
+    for (const auto &g : groups)
+    {
+        std::string name = g.name;
+        if (name.size() < groupPart.size() ||
+            name.compare(name.size() - groupPart.size(), groupPart.size(), groupPart) != 0)
+            continue;
+        run.begin_group(name);
+        g.fn(run);
+    }
+
+    if (!opts.jsonPath.empty())
+    {
+        if (opts.jsonPath == "-")
+        {
+            sb::detail::writeJson(std::cout, run.results(), opts, sb::detail::pinnedCpu);
+        }
+        else
+        {
+            std::ofstream f(opts.jsonPath);
+            if (!f)
+            {
+                std::cerr << "Could not open " << opts.jsonPath << "\n";
+                return 1;
+            }
+            sb::detail::writeJson(f, run.results(), opts, sb::detail::pinnedCpu);
+        }
+    }
+    return 0;
+}
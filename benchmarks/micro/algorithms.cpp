@@ -0,0 +1,193 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "sst/cpputils/algorithms.h"
+#include "sst/cpputils/parallel_algorithms.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(contains)
+{
+    constexpr int n{1024};
+    std::vector<int> vec(n);
+    for (int i = 0; i < n; ++i)
+        vec[i] = 3 * i;
+    std::set<int> set(vec.begin(), vec.end());
+    std::unordered_set<int> hashed(vec.begin(), vec.end());
+    std::list<int> list(vec.begin(), vec.end());
+    auto sorted = cu::assume_sorted(vec);
+    std::string text(n, 'a');
+    text.back() = 'b';
+
+    // Found at three quarters of the way through, so the scans do real work
+    int needle = 3 * (3 * n / 4);
+    bench.run("vector std::find", [&] {
+        return std::find(vec.begin(), vec.end(), needle) != vec.end();
+    });
+    bench.run("vector contains", [&] { return cu::contains(vec, needle); });
+    bench.run("list contains", [&] { return cu::contains(list, needle); });
+    bench.run("set contains", [&] { return cu::contains(set, needle); });
+    bench.run("unordered_set contains", [&] { return cu::contains(hashed, needle); });
+    bench.run("assume_sorted contains", [&] { return cu::contains(sorted, needle); });
+    bench.run("string contains", [&] { return cu::contains(text, 'b'); });
+}
+
+SST_BENCH_GROUP(contains_many)
+{
+    std::mt19937 gen(17);
+    std::vector<int> hay(4096), needles(256);
+    for (auto &h : hay)
+        h = (int)(gen() % 100000);
+    for (auto &n : needles)
+        n = (int)(gen() % 100000);
+    auto sortedHay = hay;
+    std::sort(sortedHay.begin(), sortedHay.end());
+    auto sorted = cu::assume_sorted(sortedHay);
+    std::set<int> set(hay.begin(), hay.end());
+    std::vector<bool> out(needles.size());
+
+    bench.run(
+        "contains loop",
+        [&] {
+            size_t found{0};
+            for (auto n : needles)
+                found += cu::contains(hay, n);
+            return found;
+        },
+        (double)needles.size());
+    bench.run(
+        "contains_many", [&] { return cu::contains_many(hay, needles, out); },
+        (double)needles.size());
+    bench.run(
+        "contains_many assume_sorted", [&] { return cu::contains_many(sorted, needles, out); },
+        (double)needles.size());
+    bench.run(
+        "contains_many set", [&] { return cu::contains_many(set, needles, out); },
+        (double)needles.size());
+}
+
+SST_BENCH_GROUP(contains_if)
+{
+    std::vector<double> values(1 << 20, 1.0);
+    values.back() = -1.0;
+    auto expensive = [](double v) { return std::sqrt(std::abs(v)) * v < 0; };
+    {
+        // Start the shared pool with the full CPU mask
+        cu::bench::scoped_unpin unpin;
+        cu::contains_if(cu::parallel, values, expensive);
+    }
+    bench.run(
+        "serial", [&] { return cu::contains_if(values, expensive); }, (double)values.size());
+    bench.run(
+        "parallel", [&] { return cu::contains_if(cu::parallel, values, expensive); },
+        (double)values.size());
+}
+
+SST_BENCH_GROUP(nodal_erase_if)
+{
+    constexpr int n{10000};
+    auto isOdd = [](int v) { return v & 1; };
+    std::vector<int> source(n);
+    for (int i = 0; i < n; ++i)
+        source[i] = i;
+
+    std::vector<int> vec;
+    auto fillVec = [&] { vec = source; };
+    bench.run_with_setup(
+        "vector erase loop", fillVec,
+        [&] {
+            for (auto it = vec.begin(); it != vec.end();)
+                it = isOdd(*it) ? vec.erase(it) : std::next(it);
+        },
+        n);
+    bench.run_with_setup(
+        "vector", fillVec, [&] { return cu::nodal_erase_if(vec, isOdd); }, n);
+    bench.run_with_setup(
+        "vector unordered_erase_if", fillVec, [&] { return cu::unordered_erase_if(vec, isOdd); },
+        n);
+
+    std::deque<int> deq;
+    bench.run_with_setup(
+        "deque", [&] { deq.assign(source.begin(), source.end()); },
+        [&] { return cu::nodal_erase_if(deq, isOdd); }, n);
+
+    std::list<int> list;
+    bench.run_with_setup(
+        "list", [&] { list.assign(source.begin(), source.end()); },
+        [&] { return cu::nodal_erase_if(list, isOdd); }, n);
+}
+
+SST_BENCH_GROUP(radix_sort)
+{
+    constexpr size_t n{65536};
+    std::mt19937 gen(5);
+    std::vector<uint32_t> keys(n), work, scratch(n);
+    for (auto &k : keys)
+        k = gen();
+    auto reset = [&] { work = keys; };
+    auto id = [](uint32_t k) { return k; };
+
+    bench.run_with_setup(
+        "std::sort u32", reset, [&] { std::sort(work.begin(), work.end()); }, n);
+    bench.run_with_setup(
+        "std::stable_sort u32", reset, [&] { std::stable_sort(work.begin(), work.end()); }, n);
+    bench.run_with_setup(
+        "radix_sort u32", reset, [&] { cu::radix_sort(work, scratch, id); }, n);
+
+    // Keys which only differ in their low 16 bits skip the top two passes
+    std::vector<uint32_t> narrowKeys(n);
+    for (auto &k : narrowKeys)
+        k = 0x12340000u | (gen() & 0xFFFFu);
+    bench.run_with_setup(
+        "radix_sort u32 16 bit range", [&] { work = narrowKeys; },
+        [&] { cu::radix_sort(work, scratch, id); }, n);
+
+    struct Voice
+    {
+        int64_t startedAt;
+        int note;
+        float gain;
+    };
+    std::vector<Voice> voices(n), vwork, vscratch(n);
+    for (auto &v : voices)
+        v = {(int64_t)gen() - (int64_t)(1u << 31), (int)(gen() % 128), 1.f};
+    auto vreset = [&] { vwork = voices; };
+    bench.run_with_setup(
+        "std::stable_sort struct i64 key", vreset,
+        [&] {
+            std::stable_sort(vwork.begin(), vwork.end(), [](const auto &a, const auto &b) {
+                return a.startedAt < b.startedAt;
+            });
+        },
+        n);
+    bench.run_with_setup(
+        "radix_sort struct i64 key", vreset,
+        [&] { cu::radix_sort(vwork, vscratch, [](const Voice &v) { return v.startedAt; }); },
+        n);
+}
@@ -0,0 +1,115 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <functional>
+#include <vector>
+
+#include "sst/cpputils/bindings.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+struct Voice
+{
+    float cutoff{0}, gain{1};
+    float process(float in, float mod) { return in * gain + cutoff * mod; }
+};
+
+float mix(float a, float b, float c) { return a * 0.5f + b * 0.25f + c; }
+} // namespace
+
+SST_BENCH_GROUP(bind_front)
+{
+    constexpr size_t n{1024};
+    std::vector<float> in(n, 0.5f);
+    Voice voice;
+    voice.cutoff = 0.1f;
+
+    auto sum = [&](auto &&fn) {
+        return [&in, fn]() mutable {
+            float s{0};
+            for (auto x : in)
+                s += fn(x);
+            return s;
+        };
+    };
+
+    float a{0.25f};
+    bench.run("free lambda", sum([a](float x) { return mix(a, 1.f, x); }), n);
+    bench.run("free bind_front", sum(cu::bind_front(&mix, a, 1.f)), n);
+    bench.run("free bind_front<F>", sum(cu::bind_front<&mix>(a, 1.f)), n);
+    bench.run("free bind_back", sum(cu::bind_back(&mix, 1.f, 2.f)), n);
+    bench.run("free std::bind", sum(std::bind(&mix, a, 1.f, std::placeholders::_1)), n);
+
+    auto *v = &voice;
+    bench.run("member lambda", sum([v](float x) { return v->process(x, 0.5f); }), n);
+    auto bound = cu::bind_back(cu::bind_front(&Voice::process, v), 0.5f);
+    bench.run("member bind_front", sum(bound), n);
+    auto staticBound = cu::bind_back(cu::bind_front<&Voice::process>(v), 0.5f);
+    bench.run("member bind_front<F>", sum(staticBound), n);
+    auto d = cu::delegate<float(float, float)>::create<&Voice::process>(voice);
+    bench.run("member delegate", sum([d](float x) { return d(x, 0.5f); }), n);
+}
+
+SST_BENCH_GROUP(bind_front_indirect)
+{
+    // Behind a vector of a mix of targets the compiler cannot see through the call
+    constexpr size_t n{64};
+    std::vector<Voice> voices(n);
+    for (size_t i = 0; i < n; ++i)
+        voices[i].cutoff = (float)i;
+
+    std::vector<cu::delegate<float(float, float)>> delegates;
+    for (auto &v : voices)
+        delegates.push_back(cu::delegate<float(float, float)>::create<&Voice::process>(v));
+    std::vector<std::function<float(float)>> functions;
+    for (auto &v : voices)
+        functions.emplace_back(cu::bind_back(cu::bind_front(&Voice::process, &v), 0.5f));
+    std::vector<std::function<float(float)>> lambdas;
+    for (auto &v : voices)
+        lambdas.emplace_back([p = &v](float x) { return p->process(x, 0.5f); });
+
+    bench.run(
+        "delegate",
+        [&] {
+            float s{0};
+            for (auto &d : delegates)
+                s += d(1.f, 0.5f);
+            return s;
+        },
+        n);
+    bench.run(
+        "std::function of binders",
+        [&] {
+            float s{0};
+            for (auto &f : functions)
+                s += f(1.f);
+            return s;
+        },
+        n);
+    bench.run(
+        "std::function of lambda",
+        [&] {
+            float s{0};
+            for (auto &f : lambdas)
+                s += f(1.f);
+            return s;
+        },
+        n);
+}
@@ -0,0 +1,132 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "sst/cpputils/constructors.h"
+#include "sst/cpputils/parallel_constructors.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+struct Oscillator
+{
+    Oscillator(size_t idx, float rate) : phase(0), increment(rate * (float)(idx + 1)) {}
+    float phase, increment;
+};
+
+// An element expensive enough to build that spreading the work pays
+struct Wavetable
+{
+    explicit Wavetable(size_t idx)
+    {
+        for (size_t i = 0; i < samples.size(); ++i)
+            samples[i] = std::sin(0.01f * (float)(i * (idx + 1)));
+    }
+    std::array<float, 2048> samples;
+};
+} // namespace
+
+SST_BENCH_GROUP(make_array)
+{
+    // Escaped, so the tables are built from a value the compiler cannot fold
+    float rate{0.01f};
+    cu::bench::do_not_optimize(&rate);
+
+    bench.run(
+        "std::array loop 64",
+        [&] {
+            std::array<float, 64> a;
+            for (size_t i = 0; i < a.size(); ++i)
+                a[i] = rate * (float)i;
+            cu::bench::do_not_optimize(a);
+        },
+        64);
+    bench.run(
+        "make_array_lambda 64",
+        [&] {
+            auto a = cu::make_array_lambda<float, 64>([&](auto i) { return rate * i; });
+            cu::bench::do_not_optimize(a);
+        },
+        64);
+    bench.run(
+        "make_array_bind_first_index 64",
+        [&] {
+            auto a = cu::make_array_bind_first_index<Oscillator, 64>(rate);
+            cu::bench::do_not_optimize(a);
+        },
+        64);
+    bench.run(
+        "std::array loop 4096",
+        [&] {
+            std::array<float, 4096> a;
+            for (size_t i = 0; i < a.size(); ++i)
+                a[i] = rate * (float)i;
+            cu::bench::do_not_optimize(a);
+        },
+        4096);
+    bench.run(
+        "make_array_lambda 4096",
+        [&] {
+            auto a = cu::make_array_lambda<float, 4096>([&](size_t i) { return rate * (float)i; });
+            cu::bench::do_not_optimize(a);
+        },
+        4096);
+    bench.run(
+        "make_array_bind_first_index 4096",
+        [&] {
+            auto a = cu::make_array_bind_first_index<Oscillator, 4096>(rate);
+            cu::bench::do_not_optimize(a);
+        },
+        4096);
+}
+
+SST_BENCH_GROUP(make_array_parallel)
+{
+    constexpr size_t n{64};
+    {
+        // Start the shared pool with the full CPU mask
+        cu::bench::scoped_unpin unpin;
+        cu::ThreadPool::shared();
+    }
+
+    bench.run(
+        "make_array_lambda serial",
+        [] {
+            auto a = cu::make_array_lambda<Wavetable, n>([](size_t i) { return Wavetable(i); });
+            cu::bench::do_not_optimize(a);
+        },
+        n);
+    bench.run(
+        "make_array_parallel",
+        [] {
+            auto a = cu::make_array_parallel<Wavetable, n>([](size_t i) { return Wavetable(i); });
+            cu::bench::do_not_optimize(a);
+        },
+        n);
+    bench.run(
+        "make_vector_parallel",
+        [] {
+            auto v = cu::make_vector_parallel<Wavetable>(n, [](size_t i) { return Wavetable(i); });
+            cu::bench::do_not_optimize(v.data());
+        },
+        n);
+}
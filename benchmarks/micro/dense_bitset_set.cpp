@@ -0,0 +1,92 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <random>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+#include "sst/cpputils/dense_bitset_set.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(dense_bitset_set)
+{
+    // Active voice or parameter ids: a few dozen of a few hundred possible
+    constexpr size_t universe{512}, active{48};
+    std::mt19937 gen(23);
+    std::vector<size_t> ids(active);
+    for (auto &i : ids)
+        i = gen() % universe;
+    std::vector<size_t> probes(256);
+    for (auto &p : probes)
+        p = gen() % universe;
+
+    std::set<size_t> tree(ids.begin(), ids.end());
+    std::unordered_set<size_t> hashed(ids.begin(), ids.end());
+    cu::dense_bitset_set<universe> bits;
+    for (auto i : ids)
+        bits.insert(i);
+
+    auto query = [&](const auto &s) {
+        return [&s, &probes] {
+            size_t hits{0};
+            for (auto p : probes)
+                hits += s.count(p);
+            return hits;
+        };
+    };
+    bench.run("std::set count", query(tree), (double)probes.size());
+    bench.run("std::unordered_set count", query(hashed), (double)probes.size());
+    bench.run("dense_bitset_set count", query(bits), (double)probes.size());
+
+    auto walk = [](const auto &s) {
+        return [&s] {
+            size_t sum{0};
+            for (auto v : s)
+                sum += v;
+            return sum;
+        };
+    };
+    bench.run("std::set iterate", walk(tree), (double)tree.size());
+    bench.run("std::unordered_set iterate", walk(hashed), (double)hashed.size());
+    bench.run("dense_bitset_set iterate", walk(bits), (double)tree.size());
+
+    bench.run(
+        "std::set insert erase",
+        [&] {
+            std::set<size_t> s;
+            for (auto i : ids)
+                s.insert(i);
+            for (auto i : ids)
+                s.erase(i);
+            return s.size();
+        },
+        (double)active);
+    bench.run(
+        "dense_bitset_set insert erase",
+        [&] {
+            cu::dense_bitset_set<universe> s;
+            for (auto i : ids)
+                s.insert(i);
+            for (auto i : ids)
+                s.erase(i);
+            return s.size();
+        },
+        (double)active);
+}
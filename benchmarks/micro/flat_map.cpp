@@ -0,0 +1,84 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sst/cpputils/flat_map.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(flat_map)
+{
+    using eytzinger_map =
+        cu::flat_map<uint32_t, float, std::less<uint32_t>, cu::flat_layout::eytzinger>;
+    std::mt19937 gen(11);
+
+    for (size_t n : {64, 1024, 65536})
+    {
+        std::vector<uint32_t> keys(n);
+        for (auto &k : keys)
+            k = gen();
+        std::map<uint32_t, float> tree;
+        std::unordered_map<uint32_t, float> hashed;
+        cu::flat_map<uint32_t, float> flat;
+        eytzinger_map eytzinger;
+        for (auto k : keys)
+        {
+            tree[k] = 1.f;
+            hashed[k] = 1.f;
+        }
+        flat.insert(tree.begin(), tree.end());
+        eytzinger.insert(tree.begin(), tree.end());
+
+        // Look up every key in a shuffled order
+        constexpr size_t probes{1024};
+        std::vector<uint32_t> lookups(probes);
+        for (auto &l : lookups)
+            l = keys[gen() % n];
+
+        auto find = [&](const auto &m) {
+            return [&m, &lookups] {
+                float s{0};
+                for (auto k : lookups)
+                    s += m.find(k)->second;
+                return s;
+            };
+        };
+        auto suffix = " " + std::to_string(n);
+        bench.run("std::map find" + suffix, find(tree), probes);
+        bench.run("std::unordered_map find" + suffix, find(hashed), probes);
+        bench.run("flat_map find" + suffix, find(flat), probes);
+        bench.run("flat_map eytzinger find" + suffix, find(eytzinger), probes);
+
+        auto walk = [&](const auto &m) {
+            return [&m] {
+                float s{0};
+                for (const auto &kv : m)
+                    s += kv.second;
+                return s;
+            };
+        };
+        bench.run("std::map iterate" + suffix, walk(tree), (double)n);
+        bench.run("flat_map iterate" + suffix, walk(flat), (double)n);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <functional>
+
+#include "sst/cpputils/function_ref.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+constexpr int calls{256};
+
+// Out of line consumers, as a callback taking API would be
+SST_BENCH_NOINLINE int sumRef(cu::function_ref<int(int)> fn)
+{
+    int s{0};
+    for (int i = 0; i < calls; ++i)
+        s += fn(i);
+    return s;
+}
+
+SST_BENCH_NOINLINE int sumFunction(const std::function<int(int)> &fn)
+{
+    int s{0};
+    for (int i = 0; i < calls; ++i)
+        s += fn(i);
+    return s;
+}
+
+template <typename F> SST_BENCH_NOINLINE int sumTemplate(F &&fn)
+{
+    int s{0};
+    for (int i = 0; i < calls; ++i)
+        s += fn(i);
+    return s;
+}
+
+int triple(int x) { return 3 * x; }
+} // namespace
+
+SST_BENCH_GROUP(function_ref)
+{
+    int offset{7};
+    struct Big
+    {
+        int offset, pad[7];
+        int operator()(int x) const { return x + offset; }
+    };
+    Big big{offset, {}};
+
+    bench.run(
+        "template small lambda", [&] { return sumTemplate([&](int x) { return x + offset; }); },
+        calls);
+    bench.run(
+        "function_ref small lambda", [&] { return sumRef([&](int x) { return x + offset; }); },
+        calls);
+    bench.run(
+        "std::function small lambda",
+        [&] { return sumFunction([&](int x) { return x + offset; }); }, calls);
+
+    // std::function copies the callable, and a large one onto the heap, on every call
+    bench.run("function_ref large functor", [&] { return sumRef(big); }, calls);
+    bench.run("std::function large functor", [&] { return sumFunction(big); }, calls);
+
+    bench.run("function_ref function pointer", [&] { return sumRef(&triple); }, calls);
+    bench.run("std::function function pointer", [&] { return sumFunction(&triple); }, calls);
+}
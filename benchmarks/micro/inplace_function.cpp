@@ -0,0 +1,111 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <functional>
+#include <vector>
+
+#include "sst/cpputils/inplace_function.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(inplace_function)
+{
+    // Callables of a few kinds in one array, so each call is an indirect one
+    constexpr size_t n{64};
+    std::vector<std::function<float(float)>> stdfns;
+    std::vector<cu::inplace_function<float(float)>> inplace;
+    std::vector<cu::inplace_unique_function<float(float)>> unique;
+    auto add = [&](auto fn) {
+        stdfns.emplace_back(fn);
+        inplace.emplace_back(fn);
+        unique.emplace_back(fn);
+    };
+    for (size_t i = 0; i < n; ++i)
+    {
+        float k = (float)i, c = 0.5f * (float)i, d = 0.25f;
+        if (i % 3 == 0)
+            add([k](float x) { return x * k; });
+        else if (i % 3 == 1)
+            add([k, c](float x) { return x * k + c; });
+        else
+            add([k, c, d](float x) { return (x - d) * k + c; });
+    }
+
+    float x{1.f};
+    bench.run(
+        "raw lambda",
+        [&] {
+            float s{0};
+            for (size_t i = 0; i < n; ++i)
+                s += x * (float)i;
+            return s;
+        },
+        n);
+    bench.run(
+        "std::function call",
+        [&] {
+            float s{0};
+            for (auto &f : stdfns)
+                s += f(x);
+            return s;
+        },
+        n);
+    bench.run(
+        "inplace_function call",
+        [&] {
+            float s{0};
+            for (auto &f : inplace)
+                s += f(x);
+            return s;
+        },
+        n);
+    bench.run(
+        "inplace_unique_function call",
+        [&] {
+            float s{0};
+            for (auto &f : unique)
+                s += f(x);
+            return s;
+        },
+        n);
+
+    // Installing a callable with more state than std::function keeps inline
+    struct Big
+    {
+        float coeffs[6]{1, 2, 3, 4, 5, 6};
+        float operator()(float v) const { return v * coeffs[0] + coeffs[5]; }
+    };
+    bench.run("std::function construct", [&] {
+        std::function<float(float)> f(Big{});
+        return f(x);
+    });
+    bench.run("inplace_function construct", [&] {
+        cu::inplace_function<float(float), 32> f(Big{});
+        return f(x);
+    });
+    cu::inplace_function<float(float), 32> proto(Big{});
+    std::function<float(float)> stdProto(Big{});
+    bench.run("std::function copy", [&] {
+        auto f = stdProto;
+        return f(x);
+    });
+    bench.run("inplace_function copy", [&] {
+        auto f = proto;
+        return f(x);
+    });
+}
@@ -0,0 +1,76 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <string>
+#include <vector>
+
+#include "sst/cpputils/interleave.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(interleave)
+{
+    constexpr size_t frames{512};
+    for (size_t channels : {2, 4, 6, 8})
+    {
+        std::vector<std::vector<float>> planes(channels, std::vector<float>(frames, 0.5f));
+        std::vector<const float *> in;
+        std::vector<float *> outPlanes;
+        for (auto &p : planes)
+        {
+            in.push_back(p.data());
+            outPlanes.push_back(p.data());
+        }
+        std::vector<float> mixed(channels * frames);
+        auto suffix = " " + std::to_string(channels) + "ch";
+        auto samples = (double)(channels * frames);
+
+        bench.run(
+            "loop interleave" + suffix,
+            [&] {
+                for (size_t f = 0; f < frames; ++f)
+                    for (size_t c = 0; c < channels; ++c)
+                        mixed[f * channels + c] = in[c][f];
+                return mixed[1];
+            },
+            samples);
+        bench.run(
+            "interleave" + suffix,
+            [&] {
+                cu::interleave(in.data(), mixed.data(), channels, frames);
+                return mixed[1];
+            },
+            samples);
+        bench.run(
+            "loop deinterleave" + suffix,
+            [&] {
+                for (size_t f = 0; f < frames; ++f)
+                    for (size_t c = 0; c < channels; ++c)
+                        outPlanes[c][f] = mixed[f * channels + c];
+                return outPlanes[0][1];
+            },
+            samples);
+        bench.run(
+            "deinterleave" + suffix,
+            [&] {
+                cu::deinterleave(mixed.data(), outPlanes.data(), channels, frames);
+                return outPlanes[0][1];
+            },
+            samples);
+    }
+}
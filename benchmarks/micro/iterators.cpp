@@ -0,0 +1,206 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sst/cpputils/iterators.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+struct Payload
+{
+    float value[12];
+};
+
+// A voice-sized element, several cache lines, all of which the loop reads
+struct BigPayload
+{
+    float value[64];
+};
+} // namespace
+
+SST_BENCH_GROUP(prefetching)
+{
+    // Nodes inserted in a random order, so a walk jumps around memory
+    constexpr int n{1 << 17};
+    std::mt19937 gen(3);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; ++i)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), gen);
+
+    std::map<int, Payload> map;
+    for (auto k : order)
+        map[k] = Payload{{(float)k}};
+    std::list<Payload> list;
+    std::vector<std::list<Payload>::iterator> where;
+    for (auto k : order)
+    {
+        auto at = where.empty() ? list.end() : where[gen() % where.size()];
+        where.push_back(list.insert(at, Payload{{(float)k}}));
+    }
+
+    bench.run(
+        "map walk",
+        [&] {
+            float s{0};
+            for (auto &[k, v] : map)
+                s += v.value[0];
+            return s;
+        },
+        n);
+    for (size_t distance : {2, 4, 8})
+        bench.run(
+            "map prefetching " + std::to_string(distance),
+            [&] {
+                float s{0};
+                for (auto &[k, v] : cu::prefetching(map, distance))
+                    s += v.value[0];
+                return s;
+            },
+            n);
+
+    bench.run(
+        "list walk",
+        [&] {
+            float s{0};
+            for (auto &v : list)
+                s += v.value[0];
+            return s;
+        },
+        n);
+    for (size_t distance : {2, 4, 8})
+        bench.run(
+            "list prefetching " + std::to_string(distance),
+            [&] {
+                float s{0};
+                for (auto &v : cu::prefetching(list, distance))
+                    s += v.value[0];
+                return s;
+            },
+            n);
+
+    constexpr int bigN{1 << 15};
+    std::list<BigPayload> bigList;
+    std::vector<std::list<BigPayload>::iterator> bigWhere;
+    for (int k = 0; k < bigN; ++k)
+    {
+        auto at = bigWhere.empty() ? bigList.end() : bigWhere[gen() % bigWhere.size()];
+        bigWhere.push_back(bigList.insert(at, BigPayload{{(float)k}}));
+    }
+    auto sumAll = [](const BigPayload &v) {
+        float s{0};
+        for (auto x : v.value)
+            s += x;
+        return s;
+    };
+    bench.run(
+        "big list walk",
+        [&] {
+            float s{0};
+            for (auto &v : bigList)
+                s += sumAll(v);
+            return s;
+        },
+        bigN);
+    for (size_t distance : {2, 4, 8})
+        bench.run(
+            "big list prefetching " + std::to_string(distance),
+            [&] {
+                float s{0};
+                for (auto &v : cu::prefetching(bigList, distance))
+                    s += sumAll(v);
+                return s;
+            },
+            bigN);
+}
+
+SST_BENCH_GROUP(enumerate_zip)
+{
+    constexpr size_t n{4096};
+    std::vector<float> a(n, 1.f), b(n, 2.f);
+
+    bench.run(
+        "index loop",
+        [&] {
+            float s{0};
+            for (size_t i = 0; i < n; ++i)
+                s += a[i] * (float)i;
+            return s;
+        },
+        n);
+    bench.run(
+        "enumerate",
+        [&] {
+            float s{0};
+            for (auto [i, v] : cu::enumerate(a))
+                s += v * (float)i;
+            return s;
+        },
+        n);
+    bench.run(
+        "index loop two ranges",
+        [&] {
+            float s{0};
+            for (size_t i = 0; i < n; ++i)
+                s += a[i] * b[i];
+            return s;
+        },
+        n);
+    bench.run(
+        "zip",
+        [&] {
+            float s{0};
+            for (auto [x, y] : cu::zip(a, b))
+                s += x * y;
+            return s;
+        },
+        n);
+}
+
+SST_BENCH_GROUP(strided_span)
+{
+    constexpr size_t frames{4096}, channels{4};
+    std::vector<float> buf(frames * channels, 1.f);
+
+    bench.run(
+        "raw stride loop",
+        [&] {
+            float s{0};
+            for (size_t f = 0; f < frames; ++f)
+                s += buf[f * channels + 1];
+            return s;
+        },
+        frames);
+    bench.run(
+        "strided_span",
+        [&] {
+            float s{0};
+            for (auto v : cu::strided_span(buf.data() + 1, channels, frames))
+                s += v;
+            return s;
+        },
+        frames);
+}
@@ -0,0 +1,79 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "sst/cpputils/lookup_table.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(lookup_table)
+{
+    constexpr size_t n{4096};
+    constexpr float twoPi{6.28318530718f};
+    static const auto sine =
+        cu::make_table<float, 2048>([](float x) { return std::sin(x); }, 0.f, twoPi);
+    static const auto tanh =
+        cu::make_table<float, 2048>([](float x) { return std::tanh(x); }, -4.f, 4.f);
+
+    std::mt19937 gen(31);
+    std::uniform_real_distribution<float> phase(0.f, twoPi), drive(-4.f, 4.f);
+    std::vector<float> phases(n), drives(n), out(n);
+    for (auto &p : phases)
+        p = phase(gen);
+    for (auto &d : drives)
+        d = drive(gen);
+
+    auto each = [&](const std::vector<float> &in, auto fn) {
+        return [&in, &out, fn] {
+            for (size_t i = 0; i < n; ++i)
+                out[i] = fn(in[i]);
+            return out[n - 1];
+        };
+    };
+
+    bench.run("std::sin", each(phases, [](float x) { return std::sin(x); }), n);
+    bench.run("sine lookup_linear", each(phases, [](float x) { return sine.lookup_linear(x); }),
+              n);
+    bench.run("sine lookup_cubic", each(phases, [](float x) { return sine.lookup_cubic(x); }), n);
+    bench.run(
+        "sine lookup_linear batch",
+        [&] {
+            sine.lookup_linear(phases.data(), out.data(), n);
+            return out[n - 1];
+        },
+        n);
+    bench.run(
+        "sine lookup_cubic batch",
+        [&] {
+            sine.lookup_cubic(phases.data(), out.data(), n);
+            return out[n - 1];
+        },
+        n);
+
+    bench.run("std::tanh", each(drives, [](float x) { return std::tanh(x); }), n);
+    bench.run(
+        "tanh lookup_cubic batch",
+        [&] {
+            tanh.lookup_cubic(drives.data(), out.data(), n);
+            return out[n - 1];
+        },
+        n);
+}
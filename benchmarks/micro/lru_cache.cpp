@@ -0,0 +1,64 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <random>
+#include <vector>
+
+#include "sst/cpputils/lru_cache.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+struct Rendered
+{
+    explicit Rendered(int k) : key(k) {}
+    int key;
+    float pixels[16]{};
+};
+} // namespace
+
+SST_BENCH_GROUP(lru_cache)
+{
+    constexpr int capacity{256};
+    std::mt19937 gen(29);
+    std::vector<int> hits(1024), misses(1024);
+    for (auto &h : hits)
+        h = (int)(gen() % capacity);
+    for (auto &m : misses)
+        m = (int)(gen() % (8 * capacity));
+
+    cu::LRU<int, Rendered> cache(capacity);
+    for (int i = 0; i < capacity; ++i)
+        cache.get(i);
+    cu::LRU<int, Rendered, true> unlocked(capacity);
+    for (int i = 0; i < capacity; ++i)
+        unlocked.get(i);
+
+    auto lookup = [](auto &c, const std::vector<int> &keys) {
+        return [&c, &keys] {
+            int s{0};
+            for (auto k : keys)
+                s += c.get(k)->key;
+            return s;
+        };
+    };
+    bench.run("get hit", lookup(cache, hits), (double)hits.size());
+    bench.run("get hit lock_free", lookup(unlocked, hits), (double)hits.size());
+    bench.run("get mostly miss", lookup(cache, misses), (double)misses.size());
+}
@@ -0,0 +1,95 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <array>
+
+#include "sst/cpputils/mdarray.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(mdarray)
+{
+    constexpr size_t rows{64}, cols{64};
+    std::array<std::array<float, cols>, rows> nested{};
+    auto grid = cu::make_array_nd<float, rows, cols>(
+        [](size_t r, size_t c) { return (float)(r + c); });
+    for (size_t r = 0; r < rows; ++r)
+        for (size_t c = 0; c < cols; ++c)
+            nested[r][c] = grid(r, c);
+
+    bench.run(
+        "nested std::array row sum",
+        [&] {
+            float s{0};
+            for (auto &row : nested)
+                for (auto v : row)
+                    s += v;
+            return s;
+        },
+        rows * cols);
+    bench.run(
+        "mdarray flat sum",
+        [&] {
+            float s{0};
+            for (auto v : grid)
+                s += v;
+            return s;
+        },
+        rows * cols);
+    bench.run(
+        "mdarray row views sum",
+        [&] {
+            float s{0};
+            for (size_t r = 0; r < rows; ++r)
+                for (auto v : grid.row(r))
+                    s += v;
+            return s;
+        },
+        rows * cols);
+    bench.run(
+        "nested std::array column sum",
+        [&] {
+            float s{0};
+            for (size_t c = 0; c < cols; ++c)
+                for (size_t r = 0; r < rows; ++r)
+                    s += nested[r][c];
+            return s;
+        },
+        rows * cols);
+    bench.run(
+        "mdarray column views sum",
+        [&] {
+            float s{0};
+            for (size_t c = 0; c < cols; ++c)
+                for (auto v : grid.column(c))
+                    s += v;
+            return s;
+        },
+        rows * cols);
+
+    float scale{0.5f};
+    cu::bench::do_not_optimize(&scale);
+    bench.run(
+        "make_array_nd 64x64",
+        [&] {
+            auto g = cu::make_array_nd<float, rows, cols>(
+                [&](size_t r, size_t c) { return scale * (float)(r * c); });
+            cu::bench::do_not_optimize(g);
+        },
+        rows * cols);
+}
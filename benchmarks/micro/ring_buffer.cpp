@@ -0,0 +1,75 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <deque>
+#include <vector>
+
+#include "sst/cpputils/ring_buffer.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(ring_buffer)
+{
+    constexpr size_t block{64};
+    std::vector<float> samples(block, 0.5f);
+
+    std::deque<float> deq;
+    bench.run(
+        "std::deque push pop",
+        [&] {
+            float s{0};
+            for (auto v : samples)
+                deq.push_back(v);
+            while (!deq.empty())
+            {
+                s += deq.front();
+                deq.pop_front();
+            }
+            return s;
+        },
+        block);
+
+    cu::SimpleRingBuffer<float, 1024> ring;
+    bench.run(
+        "SimpleRingBuffer push pop",
+        [&] {
+            float s{0};
+            for (auto v : samples)
+                ring.push(v);
+            while (auto v = ring.pop())
+                s += *v;
+            return s;
+        },
+        block);
+    bench.run(
+        "SimpleRingBuffer block push popall",
+        [&] {
+            ring.push(samples.data(), samples.size());
+            return ring.popall().size();
+        },
+        block);
+
+    cu::StereoRingBuffer<float, 1024> stereo;
+    bench.run(
+        "StereoRingBuffer block push popall",
+        [&] {
+            stereo.push(samples.data(), samples.data(), samples.size());
+            return stereo.popall().first.size();
+        },
+        block);
+}
@@ -0,0 +1,66 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "sst/cpputils/signal.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+struct Listener
+{
+    float last{0};
+    void onValue(float v) { last += v; }
+};
+} // namespace
+
+SST_BENCH_GROUP(signal)
+{
+    constexpr size_t slots{8};
+    std::vector<Listener> listeners(slots);
+
+    cu::signal<void(float)> sig;
+    for (auto &l : listeners)
+        sig.connect<&Listener::onValue>(l);
+
+    // The usual hand-rolled observer list, guarded against concurrent changes by a mutex
+    std::mutex lock;
+    std::vector<std::function<void(float)>> observers;
+    for (auto &l : listeners)
+        observers.emplace_back([p = &l](float v) { p->onValue(v); });
+
+    bench.run(
+        "mutex and std::function vector",
+        [&] {
+            std::lock_guard<std::mutex> g(lock);
+            for (auto &o : observers)
+                o(1.f);
+        },
+        slots);
+    bench.run("emit", [&] { sig(1.f); }, slots);
+
+    bench.run("connect and disconnect", [&] {
+        auto c = sig.connect([](float) {});
+        return sig.disconnect(c);
+    });
+    sig.collect();
+}
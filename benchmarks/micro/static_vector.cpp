@@ -0,0 +1,77 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <vector>
+
+#include "sst/cpputils/static_vector.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(static_vector)
+{
+    // Gathering up to 16 items, as per-block event or voice lists do
+    constexpr int n{16};
+
+    bench.run(
+        "std::vector",
+        [] {
+            std::vector<int> v;
+            for (int i = 0; i < n; ++i)
+                v.push_back(i);
+            return v.back();
+        },
+        n);
+    std::vector<int> reused;
+    reused.reserve(n);
+    bench.run(
+        "std::vector reserved and reused",
+        [&] {
+            reused.clear();
+            for (int i = 0; i < n; ++i)
+                reused.push_back(i);
+            return reused.back();
+        },
+        n);
+    bench.run(
+        "static_vector",
+        [] {
+            cu::static_vector<int, n> v;
+            for (int i = 0; i < n; ++i)
+                v.push_back(i);
+            return v.back();
+        },
+        n);
+    bench.run(
+        "small_vector inline",
+        [] {
+            cu::small_vector<int, n> v;
+            for (int i = 0; i < n; ++i)
+                v.push_back(i);
+            return v.back();
+        },
+        n);
+    bench.run(
+        "small_vector spilled",
+        [] {
+            cu::small_vector<int, n / 4> v;
+            for (int i = 0; i < n; ++i)
+                v.push_back(i);
+            return v.back();
+        },
+        n);
+}
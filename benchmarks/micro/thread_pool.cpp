@@ -0,0 +1,63 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "sst/cpputils/thread_pool.h"
+
+namespace cu = sst::cpputils;
+
+SST_BENCH_GROUP(thread_pool)
+{
+    std::unique_ptr<cu::ThreadPool> pool;
+    {
+        cu::bench::scoped_unpin unpin;
+        pool = std::make_unique<cu::ThreadPool>();
+    }
+    auto chunks = pool->concurrency();
+
+    // The fixed cost of handing out work and waiting for it
+    bench.run("parallel_for empty", [&] { pool->parallel_for(chunks, [](size_t) {}); });
+
+    constexpr size_t n{1 << 18};
+    std::vector<float> data(n, 0.5f), out(n);
+    auto work = [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i)
+            out[i] = std::sqrt(data[i]) * std::sin(data[i]);
+    };
+    bench.run(
+        "serial loop",
+        [&] {
+            work(0, n);
+            return out[n - 1];
+        },
+        n);
+    bench.run(
+        "parallel_for",
+        [&] {
+            auto per = (n + chunks - 1) / chunks;
+            pool->parallel_for(chunks, [&](size_t c) {
+                work(c * per, std::min(n, (c + 1) * per));
+            });
+            return out[n - 1];
+        },
+        n);
+}
@@ -0,0 +1,98 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#include "bench.h"
+
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "sst/cpputils/bindings.h"
+#include "sst/cpputils/unique_function.h"
+
+namespace cu = sst::cpputils;
+
+namespace
+{
+int sumBuffer(const std::vector<int> &buf, int scale)
+{
+    return scale * std::accumulate(buf.begin(), buf.end(), 0);
+}
+} // namespace
+
+SST_BENCH_GROUP(unique_function)
+{
+    // A job owning its input: before unique_function this needed a shared_ptr to get into a
+    // std::function
+    std::vector<int> proto(16, 1);
+    bench.run("std::function with shared_ptr", [&] {
+        auto buf = std::make_shared<std::vector<int>>(proto);
+        std::function<int()> job = [buf] { return sumBuffer(*buf, 2); };
+        return job();
+    });
+    bench.run("unique_function with unique_ptr", [&] {
+        auto buf = std::make_unique<std::vector<int>>(proto);
+        cu::unique_function<int()> job = [b = std::move(buf)] { return sumBuffer(*b, 2); };
+        return job();
+    });
+    bench.run("unique_function bind_front", [&] {
+        cu::unique_function<int()> job = cu::bind_front(&sumBuffer, std::vector<int>(proto), 2);
+        return job();
+    });
+
+    // Calls through a mix of inline and heap-boxed targets
+    constexpr size_t n{64};
+    struct Wide
+    {
+        int k, pad[16];
+        int operator()(int x) const { return x * k; }
+    };
+    std::vector<cu::unique_function<int(int)>> uniques;
+    std::vector<std::function<int(int)>> functions;
+    for (size_t i = 0; i < n; ++i)
+    {
+        int k = (int)i;
+        if (i % 2)
+        {
+            uniques.emplace_back([k](int x) { return x + k; });
+            functions.emplace_back([k](int x) { return x + k; });
+        }
+        else
+        {
+            uniques.emplace_back(Wide{k, {}});
+            functions.emplace_back(Wide{k, {}});
+        }
+    }
+    bench.run(
+        "std::function call",
+        [&] {
+            int s{0};
+            for (auto &f : functions)
+                s += f(3);
+            return s;
+        },
+        n);
+    bench.run(
+        "unique_function call",
+        [&] {
+            int s{0};
+            for (auto &f : uniques)
+                s += f(3);
+            return s;
+        },
+        n);
+}
@@ -19,4 +19,14 @@
 #include "sst/cpputils/lru_cache.h"
 #include "sst/cpputils/ring_buffer.h"
 #include "sst/cpputils/bindings.h"
+#include "sst/cpputils/inplace_function.h"
+#include "sst/cpputils/unique_function.h"
+#include "sst/cpputils/function_ref.h"
+#include "sst/cpputils/signal.h"
 #include "sst/cpputils/constructors.h"
+#include "sst/cpputils/lookup_table.h"
+#include "sst/cpputils/mdarray.h"
+#include "sst/cpputils/interleave.h"
+#include "sst/cpputils/static_vector.h"
+#include "sst/cpputils/flat_map.h"
+#include "sst/cpputils/dense_bitset_set.h"
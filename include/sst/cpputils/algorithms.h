@@ -18,6 +18,18 @@
 #define INCLUDE_SST_CPPUTILS_ALGORITHMS_H
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "detail/platform.h"
 
 namespace sst
 {
@@ -25,12 +37,572 @@ namespace cpputils
 {
 
 /**
- * Wrapper of std::find to check if a container contains a value.
+ * A view of an iterator range which the caller promises is sorted with respect to Compare.
+ * Algorithms which understand it (like contains) use a binary search instead of a linear scan.
+ * Make one with assume_sorted.
+ */
+template <class Iter, class Compare = std::less<>> class sorted_view
+{
+  public:
+    using value_type = typename std::iterator_traits<Iter>::value_type;
+
+    constexpr sorted_view(Iter b, Iter e, Compare c = Compare{}) : b_(b), e_(e), comp_(c) {}
+
+    constexpr Iter begin() const { return b_; }
+    constexpr Iter end() const { return e_; }
+    constexpr const Compare &comp() const { return comp_; }
+
+  private:
+    Iter b_, e_;
+    Compare comp_;
+};
+
+/**
+ * Tag a container (or anything with begin/end) as sorted, so that
+ * `contains(assume_sorted(v), x)` is O(log n). It is not checked; if the range is not actually
+ * sorted by `comp` the results are unspecified.
+ */
+template <class ContainerType, class Compare = std::less<>>
+constexpr auto assume_sorted(const ContainerType &container, Compare comp = Compare{})
+{
+    return sorted_view<decltype(std::begin(container)), Compare>{std::begin(container),
+                                                                 std::end(container), comp};
+}
+
+/**
+ * Trait for ranges which are known to be sorted and expose their ordering with a comp()
+ * member. True for sorted_view; specialize it for your own sorted containers.
+ */
+template <class T> struct is_sorted_range : std::false_type
+{
+};
+template <class Iter, class Compare>
+struct is_sorted_range<sorted_view<Iter, Compare>> : std::true_type
+{
+};
+template <class T> inline constexpr bool is_sorted_range_v = is_sorted_range<T>::value;
+
+#ifndef DOXYGEN
+namespace detail
+{
+template <class ContainerType, class T, class = void> struct has_member_contains : std::false_type
+{
+};
+template <class ContainerType, class T>
+struct has_member_contains<
+    ContainerType, T,
+    std::enable_if_t<std::is_same_v<
+        decltype(std::declval<const ContainerType &>().contains(std::declval<const T &>())),
+        bool>>> : std::true_type
+{
+};
+
+// Only a find returning an iterator counts; std::string::find returns a position.
+template <class ContainerType, class T, class = void> struct has_member_find : std::false_type
+{
+};
+template <class ContainerType, class T>
+struct has_member_find<
+    ContainerType, T,
+    std::enable_if_t<std::is_same_v<
+        decltype(std::declval<const ContainerType &>().find(std::declval<const T &>())),
+        decltype(std::declval<const ContainerType &>().end())>>> : std::true_type
+{
+};
+
+// Containers which expose their elements as one contiguous array of arithmetic values
+// (std::vector, std::array, std::string, ...) and are being searched for a value of exactly
+// that type can use the vectorized scan below. vector<bool> has no data() so is excluded.
+template <class ContainerType, class T, class = void> struct is_simd_searchable : std::false_type
+{
+};
+template <class ContainerType, class T>
+struct is_simd_searchable<
+    ContainerType, T,
+    std::enable_if_t<std::is_pointer_v<decltype(std::declval<const ContainerType &>().data())> &&
+                     std::is_integral_v<decltype(std::declval<const ContainerType &>().size())>>>
+{
+    using element_t = std::remove_cv_t<
+        std::remove_pointer_t<decltype(std::declval<const ContainerType &>().data())>>;
+    static constexpr bool value =
+        std::is_same_v<element_t, std::remove_cv_t<T>> && std::is_arithmetic_v<element_t> &&
+        !std::is_same_v<element_t, bool> &&
+        (sizeof(element_t) == 1 || sizeof(element_t) == 2 || sizeof(element_t) == 4 ||
+         sizeof(element_t) == 8);
+};
+
+// The scalar scan simd_find_index stands in for, usable in constant expressions
+template <typename T> constexpr size_t constexpr_find_index(const T *p, size_t n, T v)
+{
+    for (size_t i = 0; i < n; ++i)
+        if (p[i] == v)
+            return i;
+    return n;
+}
+
+/*
+ * Index of the first element equal to v in p[0..n), or n. Bytes go to memchr; wider types
+ * compare a whole register at a time and only drop to scalar code to locate the hit within
+ * the register and for the tail. Floating point keeps operator== semantics (NaN is never
+ * found, -0 == +0).
+ */
+template <typename T> size_t simd_find_index(const T *p, size_t n, T v)
+{
+    if (n == 0)
+        return n;
+
+    if constexpr (sizeof(T) == 1)
+    {
+        auto hit = std::memchr(p, static_cast<unsigned char>(v), n);
+        return hit ? static_cast<size_t>(static_cast<const T *>(hit) - p) : n;
+    }
+    else
+    {
+        size_t i{0};
+        auto locate = [&](size_t from, size_t lanes) {
+            for (size_t j = from; j < from + lanes; ++j)
+                if (p[j] == v)
+                    return j;
+            return n;
+        };
+        (void)locate;
+
+#if SST_CPPUTILS_SIMD_AVX2
+        {
+            constexpr size_t lanes = 32 / sizeof(T);
+            if constexpr (std::is_same_v<T, float>)
+            {
+                auto needle = _mm256_set1_ps(v);
+                for (; i + lanes <= n; i += lanes)
+                    if (_mm256_movemask_ps(
+                            _mm256_cmp_ps(_mm256_loadu_ps(p + i), needle, _CMP_EQ_OQ)))
+                        return locate(i, lanes);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                auto needle = _mm256_set1_pd(v);
+                for (; i + lanes <= n; i += lanes)
+                    if (_mm256_movemask_pd(
+                            _mm256_cmp_pd(_mm256_loadu_pd(p + i), needle, _CMP_EQ_OQ)))
+                        return locate(i, lanes);
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                __m256i needle;
+                if constexpr (sizeof(T) == 2)
+                    needle = _mm256_set1_epi16(static_cast<short>(v));
+                else if constexpr (sizeof(T) == 4)
+                    needle = _mm256_set1_epi32(static_cast<int>(v));
+                else
+                    needle = _mm256_set1_epi64x(static_cast<long long>(v));
+
+                for (; i + lanes <= n; i += lanes)
+                {
+                    auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                    __m256i eq;
+                    if constexpr (sizeof(T) == 2)
+                        eq = _mm256_cmpeq_epi16(d, needle);
+                    else if constexpr (sizeof(T) == 4)
+                        eq = _mm256_cmpeq_epi32(d, needle);
+                    else
+                        eq = _mm256_cmpeq_epi64(d, needle);
+                    if (_mm256_movemask_epi8(eq))
+                        return locate(i, lanes);
+                }
+            }
+        }
+#endif
+
+#if SST_CPPUTILS_SIMD_SSE2
+        {
+            constexpr size_t lanes = 16 / sizeof(T);
+            if constexpr (std::is_same_v<T, float>)
+            {
+                auto needle = _mm_set1_ps(v);
+                for (; i + lanes <= n; i += lanes)
+                    if (_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), needle)))
+                        return locate(i, lanes);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                auto needle = _mm_set1_pd(v);
+                for (; i + lanes <= n; i += lanes)
+                    if (_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(p + i), needle)))
+                        return locate(i, lanes);
+            }
+            else if constexpr (std::is_integral_v<T> && (sizeof(T) == 2 || sizeof(T) == 4))
+            {
+                // SSE2 has no 64 bit integer compare; those take the scalar loop
+                __m128i needle;
+                if constexpr (sizeof(T) == 2)
+                    needle = _mm_set1_epi16(static_cast<short>(v));
+                else
+                    needle = _mm_set1_epi32(static_cast<int>(v));
+
+                for (; i + lanes <= n; i += lanes)
+                {
+                    auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                    __m128i eq;
+                    if constexpr (sizeof(T) == 2)
+                        eq = _mm_cmpeq_epi16(d, needle);
+                    else
+                        eq = _mm_cmpeq_epi32(d, needle);
+                    if (_mm_movemask_epi8(eq))
+                        return locate(i, lanes);
+                }
+            }
+        }
+#elif SST_CPPUTILS_SIMD_NEON64
+        {
+            constexpr size_t lanes = 16 / sizeof(T);
+            auto any = [](uint32x4_t m) { return vmaxvq_u32(m) != 0; };
+            if constexpr (std::is_same_v<T, float>)
+            {
+                auto needle = vdupq_n_f32(v);
+                for (; i + lanes <= n; i += lanes)
+                    if (any(vceqq_f32(vld1q_f32(p + i), needle)))
+                        return locate(i, lanes);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                auto needle = vdupq_n_f64(v);
+                for (; i + lanes <= n; i += lanes)
+                    if (any(vreinterpretq_u32_u64(vceqq_f64(vld1q_f64(p + i), needle))))
+                        return locate(i, lanes);
+            }
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 2)
+            {
+                auto needle = vdupq_n_u16(static_cast<uint16_t>(v));
+                for (; i + lanes <= n; i += lanes)
+                {
+                    auto d = vld1q_u16(reinterpret_cast<const uint16_t *>(p + i));
+                    if (any(vreinterpretq_u32_u16(vceqq_u16(d, needle))))
+                        return locate(i, lanes);
+                }
+            }
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+            {
+                auto needle = vdupq_n_u32(static_cast<uint32_t>(v));
+                for (; i + lanes <= n; i += lanes)
+                {
+                    auto d = vld1q_u32(reinterpret_cast<const uint32_t *>(p + i));
+                    if (any(vceqq_u32(d, needle)))
+                        return locate(i, lanes);
+                }
+            }
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 8)
+            {
+                auto needle = vdupq_n_u64(static_cast<uint64_t>(v));
+                for (; i + lanes <= n; i += lanes)
+                {
+                    auto d = vld1q_u64(reinterpret_cast<const uint64_t *>(p + i));
+                    if (any(vreinterpretq_u32_u64(vceqq_u64(d, needle))))
+                        return locate(i, lanes);
+                }
+            }
+        }
+#endif
+
+        for (; i < n; ++i)
+            if (p[i] == v)
+                return i;
+        return n;
+    }
+}
+} // namespace detail
+#endif // DOXYGEN
+
+/**
+ * Find a value in a container, returning an iterator to it or container.end(). This uses the
+ * same compile time dispatch as contains: associative containers use their own find,
+ * contiguous arrays of arithmetic values use a vectorized scan, ranges tagged with
+ * assume_sorted use std::lower_bound and anything else is std::find.
+ */
+template <class ContainerType, class T>
+constexpr auto find(ContainerType &&container, const T &value)
+{
+    using C = std::remove_cv_t<std::remove_reference_t<ContainerType>>;
+    if constexpr (detail::has_member_find<C, T>::value)
+    {
+        return container.find(value);
+    }
+    else if constexpr (detail::is_simd_searchable<C, T>::value)
+    {
+        auto n = (size_t)container.size();
+        auto idx = detail::is_constant_evaluated()
+                       ? detail::constexpr_find_index(container.data(), n, value)
+                       : detail::simd_find_index(container.data(), n, value);
+        return std::next(std::begin(container), idx);
+    }
+    else if constexpr (is_sorted_range_v<C>)
+    {
+        auto res = std::lower_bound(container.begin(), container.end(), value, container.comp());
+        if (res != container.end() && container.comp()(value, *res))
+            res = container.end();
+        return res;
+    }
+    else
+    {
+        return std::find(std::begin(container), std::end(container), value);
+    }
+}
+
+/**
+ * Check if a container contains a value. The lookup is picked at compile time:
+ * - containers with a `contains(key)` member (std::set, std::map in C++20, ...) use it;
+ * - containers with an iterator-returning `find(key)` member (std::map, std::unordered_set,
+ *   ...) use that, so associative lookups stay O(log n) or O(1);
+ * - contiguous containers of arithmetic values (std::vector<int>, std::array<float, N>,
+ *   std::string, ...) searched for a value of the element type use an SSE2/AVX2/NEON
+ *   compare-and-movemask scan, or memchr for bytes;
+ * - ranges tagged with assume_sorted use std::binary_search;
+ * - everything else is a linear std::find.
+ *
+ * For maps the value is therefore the key. Searching a map for a whole key/value pair still
+ * works, and falls through to the linear scan.
  */
 template <class ContainerType, class T>
 constexpr bool contains(const ContainerType &container, const T &value)
 {
-    return std::find(container.begin(), container.end(), value) != container.end();
+    if constexpr (detail::has_member_contains<ContainerType, T>::value)
+    {
+        return container.contains(value);
+    }
+    else if constexpr (detail::has_member_find<ContainerType, T>::value)
+    {
+        return container.find(value) != container.end();
+    }
+    else if constexpr (detail::is_simd_searchable<ContainerType, T>::value)
+    {
+        auto n = (size_t)container.size();
+        if (detail::is_constant_evaluated())
+            return detail::constexpr_find_index(container.data(), n, value) != n;
+        return detail::simd_find_index(container.data(), n, value) != n;
+    }
+    else if constexpr (is_sorted_range_v<ContainerType>)
+    {
+        return std::binary_search(container.begin(), container.end(), value, container.comp());
+    }
+    else
+    {
+        return std::find(container.begin(), container.end(), value) != container.end();
+    }
+}
+
+#ifndef DOXYGEN
+namespace detail
+{
+template <class T, class = void> struct is_hashable : std::false_type
+{
+};
+template <class T>
+struct is_hashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>>
+    : std::is_default_constructible<std::hash<T>>
+{
+};
+
+template <class T, class = void> struct is_equality_comparable : std::false_type
+{
+};
+template <class T>
+struct is_equality_comparable<
+    T, std::void_t<decltype(std::declval<const T &>() == std::declval<const T &>())>>
+    : std::true_type
+{
+};
+
+template <class T, class = void> struct is_less_comparable : std::false_type
+{
+};
+template <class T>
+struct is_less_comparable<
+    T, std::void_t<decltype(std::declval<const T &>() < std::declval<const T &>())>>
+    : std::true_type
+{
+};
+} // namespace detail
+#endif // DOXYGEN
+
+/**
+ * Batch membership: for each needles[i], set out[i] to whether container contains it, and
+ * return how many were found. `out` is anything indexable with assignable bools
+ * (std::vector<bool>, std::bitset, a bool array) with room for needles.size() entries.
+ *
+ * Calling contains in a loop is O(n * m). Instead the strategy is picked from the container
+ * and the sizes:
+ * - associative containers, or very few needles: one contains per needle, which for
+ *   contiguous arithmetic containers is the vectorized scan;
+ * - ranges tagged with assume_sorted: sort the needles and merge, O(n + m log m);
+ * - hashable needles: hash the needles and make one pass over the container, O(n + m);
+ * - otherwise, if the needles are ordered: sort them and binary search each element,
+ *   O((n + m) log m).
+ * The single pass strategies stop as soon as every needle has been seen.
+ */
+template <class ContainerType, class NeedleContainer, class OutBits>
+size_t contains_many(const ContainerType &container, const NeedleContainer &needles,
+                     OutBits &out)
+{
+    using needle_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(needles))>>;
+    constexpr size_t fewNeedles{8};
+    constexpr size_t npos = ~size_t(0);
+
+    auto nb = std::begin(needles);
+    size_t m = static_cast<size_t>(std::distance(nb, std::end(needles)));
+    for (size_t i = 0; i < m; ++i)
+        out[i] = false;
+
+    // generic, so it is only instantiated where it is called with a container we can search
+    auto oneAtATime = [&](const auto &c) {
+        size_t found{0};
+        size_t i{0};
+        for (auto it = nb; i < m; ++it, ++i)
+        {
+            if (contains(c, *it))
+            {
+                out[i] = true;
+                found++;
+            }
+        }
+        return found;
+    };
+
+    // needles sorted by value, as indices into needles so we can report in the original order
+    auto sortedNeedleIndices = [&](const auto &comp) {
+        std::vector<const needle_t *> ptrs;
+        ptrs.reserve(m);
+        for (auto it = nb; it != std::end(needles); ++it)
+            ptrs.push_back(&*it);
+        std::vector<size_t> idx(m);
+        std::iota(idx.begin(), idx.end(), 0);
+        std::sort(idx.begin(), idx.end(),
+                  [&](size_t a, size_t b) { return comp(*ptrs[a], *ptrs[b]); });
+        return std::make_pair(std::move(ptrs), std::move(idx));
+    };
+
+    // Only emptiness is needed; std::distance would walk every node of a std::set or list
+    if (m == 0 || std::begin(container) == std::end(container))
+    {
+        return 0;
+    }
+    else if constexpr (detail::has_member_contains<ContainerType, needle_t>::value ||
+                       detail::has_member_find<ContainerType, needle_t>::value)
+    {
+        return oneAtATime(container);
+    }
+    else if constexpr (is_sorted_range_v<ContainerType>)
+    {
+        const auto &comp = container.comp();
+        auto [ptrs, idx] = sortedNeedleIndices(comp);
+        size_t found{0}, j{0};
+        auto it = container.begin();
+        while (j < m && it != container.end())
+        {
+            const auto &nv = *ptrs[idx[j]];
+            if (comp(*it, nv))
+            {
+                ++it;
+            }
+            else
+            {
+                if (!comp(nv, *it))
+                {
+                    out[idx[j]] = true;
+                    found++;
+                }
+                ++j;
+            }
+        }
+        return found;
+    }
+    else
+    {
+        if constexpr (detail::is_equality_comparable<needle_t>::value)
+        {
+            if (m <= fewNeedles)
+                return oneAtATime(container);
+        }
+
+        if constexpr (detail::is_hashable<needle_t>::value)
+        {
+            // Equal needles are chained so one hit marks all of them
+            std::unordered_map<needle_t, size_t> first;
+            first.reserve(m);
+            std::vector<size_t> nextDup(m, npos);
+            size_t i{0}, distinct{0};
+            for (auto it = nb; i < m; ++it, ++i)
+            {
+                auto [pos, inserted] = first.emplace(*it, i);
+                if (inserted)
+                {
+                    distinct++;
+                }
+                else
+                {
+                    nextDup[i] = nextDup[pos->second];
+                    nextDup[pos->second] = i;
+                }
+            }
+
+            size_t found{0}, distinctFound{0};
+            for (const auto &v : container)
+            {
+                auto pos = first.find(v);
+                if (pos == first.end() || out[pos->second])
+                    continue;
+                for (auto k = pos->second; k != npos; k = nextDup[k])
+                {
+                    out[k] = true;
+                    found++;
+                }
+                if (++distinctFound == distinct)
+                    break;
+            }
+            return found;
+        }
+        else if constexpr (detail::is_less_comparable<needle_t>::value)
+        {
+            auto comp = std::less<>();
+            auto [ptrs, idx] = sortedNeedleIndices(comp);
+            auto lessThan = [&ptrs = ptrs](size_t a, const auto &v) { return *ptrs[a] < v; };
+            size_t found{0};
+            for (const auto &v : container)
+            {
+                auto lb = std::lower_bound(idx.begin(), idx.end(), v, lessThan);
+                for (; lb != idx.end() && !(v < *ptrs[*lb]); ++lb)
+                {
+                    if (out[*lb])
+                        break;
+                    out[*lb] = true;
+                    found++;
+                }
+                if (found == m)
+                    break;
+            }
+            return found;
+        }
+        else
+        {
+            return oneAtATime(container);
+        }
+    }
+}
+
+/**
+ * Batch membership returning the indices (into needles, ascending) of the needles which the
+ * container contains. See the bitmask version for how the lookup is done.
+ */
+template <class ContainerType, class NeedleContainer>
+std::vector<size_t> contains_many(const ContainerType &container, const NeedleContainer &needles)
+{
+    auto m = static_cast<size_t>(std::distance(std::begin(needles), std::end(needles)));
+    std::vector<bool> bits(m);
+    auto found = contains_many(container, needles, bits);
+    std::vector<size_t> res;
+    res.reserve(found);
+    for (size_t i = 0; i < m; ++i)
+        if (bits[i])
+            res.push_back(i);
+    return res;
 }
 
 /**
@@ -43,19 +615,228 @@ constexpr bool contains_if(const ContainerType &container, UnaryPredicate q)
     return std::find_if(container.begin(), container.end(), q) != container.end();
 }
 
+#ifndef DOXYGEN
+namespace detail
+{
+// Sequence containers with random access iterators and a range erase (std::vector, std::deque,
+// std::string, ...) where a single remove_if compaction beats erasing one element at a time.
+template <class ContainerType, class = void> struct is_compactable : std::false_type
+{
+};
+template <class ContainerType>
+struct is_compactable<ContainerType,
+                      std::void_t<decltype(std::declval<ContainerType &>().erase(
+                          std::declval<ContainerType &>().begin(),
+                          std::declval<ContainerType &>().end()))>>
+    : std::is_base_of<std::random_access_iterator_tag,
+                      typename std::iterator_traits<decltype(std::declval<ContainerType &>()
+                                                                  .begin())>::iterator_category>
+{
+};
+} // namespace detail
+#endif // DOXYGEN
+
 /**
  * Similar to std::erase_if, but much easier to use for node-based containers (e.g. std::map).
+ * Random access sequence containers (std::vector, std::deque, std::string) are compacted with
+ * a single std::remove_if pass and one range erase, so the whole call is O(n) rather than an
+ * O(n) shift per erased element. Returns the number of elements erased.
  */
 template <class ContainerType, class UnaryPredicate>
-constexpr void nodal_erase_if(ContainerType &container, UnaryPredicate q)
+constexpr auto nodal_erase_if(ContainerType &container, UnaryPredicate q)
+{
+    auto oldSize = container.size();
+    if constexpr (detail::is_compactable<ContainerType>::value)
+    {
+        container.erase(std::remove_if(container.begin(), container.end(), q), container.end());
+    }
+    else
+    {
+        for (auto it = container.begin(); it != container.end();)
+        {
+            if (q(*it))
+                it = container.erase(it);
+            else
+                ++it;
+        }
+    }
+    return oldSize - container.size();
+}
+
+/**
+ * Like nodal_erase_if, but never frees memory, so it can run on the audio thread. Matching
+ * elements are unlinked from the container and handed to `sink` to be destroyed somewhere
+ * else, for instance pushed onto a SimpleRingBuffer drained by a garbage collection thread.
+ *
+ * - For containers with node handles (std::map, std::set, the unordered containers and their
+ *   multi variants) each match is extract()ed and sink is called with the node handle as an
+ *   rvalue.
+ * - For std::list, pass another list of the same type as the sink; matches are spliced into
+ *   it, which is constant time and does not allocate.
+ *
+ * Returns the number of elements extracted.
+ */
+template <class ContainerType, class UnaryPredicate, class Sink>
+size_t extract_if(ContainerType &container, UnaryPredicate q, Sink &&sink)
 {
+    size_t ct{0};
     for (auto it = container.begin(); it != container.end();)
     {
+        auto next = std::next(it);
         if (q(*it))
-            it = container.erase(it);
+        {
+            if constexpr (std::is_same_v<std::decay_t<Sink>, ContainerType>)
+                sink.splice(sink.end(), container, it);
+            else
+                sink(container.extract(it));
+            ct++;
+        }
+        it = next;
+    }
+    return ct;
+}
+
+/**
+ * Erase the elements matching the predicate from a vector-like container whose order does
+ * not matter (active voice lists and the like). Each hole is filled by moving in a surviving
+ * element from the back, so every removal costs at most one move instead of shifting the tail,
+ * and the container is only shrunk once at the end so its capacity is preserved. The relative
+ * order of the remaining elements is not preserved. Returns the number of elements erased.
+ */
+template <class ContainerType, class UnaryPredicate>
+auto unordered_erase_if(ContainerType &container, UnaryPredicate q)
+{
+    auto first = container.begin();
+    auto last = container.end();
+    while (first != last)
+    {
+        if (q(*first))
+        {
+            // find the last survivor to fill the hole with
+            do
+            {
+                --last;
+            } while (first != last && q(*last));
+
+            if (first == last)
+                break;
+            *first = std::move(*last);
+        }
+        ++first;
+    }
+    auto removed = static_cast<typename ContainerType::size_type>(container.end() - first);
+    container.erase(first, container.end());
+    return removed;
+}
+
+/**
+ * Stable LSD radix sort of [first, last) by an integer key, for the few hundred timestamped
+ * events we sort every block. `key(element)` must return an integral type; signed keys sort
+ * correctly, negative first. One histogram pass counts every byte of every key, then each
+ * byte in which the keys actually differ costs one scatter pass; high bytes which are the same
+ * for all keys (small frame offsets in a uint32) are skipped.
+ *
+ * Elements are moved back and forth between the range and `scratch`, which must point at
+ * last - first already constructed elements, so nothing is allocated. Below 32 elements an
+ * insertion sort is used instead.
+ *
+ * ```
+ * struct Event { uint32_t frameOffset; ... };
+ * std::array<Event, 512> scratch;
+ * radix_sort(events.begin(), events.end(), scratch.begin(),
+ *            [](const Event &e) { return e.frameOffset; });
+ * ```
+ */
+template <class RandomIt, class ScratchIt, class KeyFn>
+void radix_sort(RandomIt first, RandomIt last, ScratchIt scratch, KeyFn key)
+{
+    using key_t = std::decay_t<decltype(key(*first))>;
+    static_assert(std::is_integral_v<key_t>, "radix_sort needs an integral key");
+    using ukey_t = std::make_unsigned_t<key_t>;
+    constexpr size_t bytes = sizeof(key_t);
+    constexpr size_t insertionCutoff = 32;
+
+    // flipping the sign bit maps signed order onto unsigned order
+    auto ukey = [&key](const auto &v) {
+        auto k = static_cast<ukey_t>(key(v));
+        if constexpr (std::is_signed_v<key_t>)
+            k ^= ukey_t(1) << (8 * bytes - 1);
+        return k;
+    };
+
+    auto n = static_cast<size_t>(last - first);
+    if (n < 2)
+        return;
+
+    if (n < insertionCutoff)
+    {
+        for (auto i = first + 1; i != last; ++i)
+        {
+            auto k = ukey(*i);
+            if (!(k < ukey(*(i - 1))))
+                continue;
+            auto v = std::move(*i);
+            auto j = i;
+            do
+            {
+                *j = std::move(*(j - 1));
+                --j;
+            } while (j != first && k < ukey(*(j - 1)));
+            *j = std::move(v);
+        }
+        return;
+    }
+
+    size_t counts[bytes][256] = {};
+    for (auto it = first; it != last; ++it)
+    {
+        auto k = ukey(*it);
+        for (size_t b = 0; b < bytes; ++b)
+            counts[b][(k >> (8 * b)) & 0xFF]++;
+    }
+
+    bool inScratch{false};
+    for (size_t b = 0; b < bytes; ++b)
+    {
+        auto &c = counts[b];
+        // every key has the same digit here, so this pass would change nothing
+        if (c[(ukey(inScratch ? *scratch : *first) >> (8 * b)) & 0xFF] == n)
+            continue;
+
+        size_t offs[256];
+        size_t sum{0};
+        for (size_t d = 0; d < 256; ++d)
+        {
+            offs[d] = sum;
+            sum += c[d];
+        }
+
+        auto scatter = [&](auto from, auto to) {
+            for (size_t i = 0; i < n; ++i)
+            {
+                auto d = (ukey(from[i]) >> (8 * b)) & 0xFF;
+                to[offs[d]++] = std::move(from[i]);
+            }
+        };
+        if (inScratch)
+            scatter(scratch, first);
         else
-            ++it;
+            scatter(first, scratch);
+        inScratch = !inScratch;
     }
+
+    if (inScratch)
+        std::move(scratch, scratch + n, first);
+}
+
+/**
+ * radix_sort over a whole container, with a scratch container of at least the same size.
+ */
+template <class ContainerType, class ScratchType, class KeyFn>
+void radix_sort(ContainerType &container, ScratchType &scratch, KeyFn key)
+{
+    assert(std::size(scratch) >= std::size(container));
+    radix_sort(std::begin(container), std::end(container), std::begin(scratch), key);
 }
 
 } // namespace cpputils
@@ -17,7 +17,10 @@
 #ifndef INCLUDE_SST_CPPUTILS_BINDINGS_H
 #define INCLUDE_SST_CPPUTILS_BINDINGS_H
 
+#include <functional>
+#include <memory>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace sst
@@ -27,29 +30,149 @@ namespace cpputils
 #ifndef DOXYGEN
 namespace detail
 {
+template <typename T> struct member_pointer_class;
+template <typename M, typename C> struct member_pointer_class<M C::*>
+{
+    using type = C;
+};
+
+template <typename T> struct is_reference_wrapper : std::false_type
+{
+};
+template <typename T> struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type
+{
+};
+
+// The object a member pointer applies to: obj itself, a reference_wrapper's target, or *obj
+template <typename C, typename Obj> constexpr decltype(auto) memberTarget(Obj &&obj)
+{
+    if constexpr (std::is_base_of_v<C, std::decay_t<Obj>>)
+        return std::forward<Obj>(obj);
+    else if constexpr (is_reference_wrapper<std::decay_t<Obj>>::value)
+        return obj.get();
+    else
+        return *std::forward<Obj>(obj);
+}
+
+/*
+ * std::invoke, which is not constexpr until C++20, so that binders over member pointers can
+ * be evaluated at compile time. It stays as shallow as it can, so that GCC's early inliner
+ * still reaches the target through a binder.
+ */
+template <typename F, typename Obj, typename... Args>
+constexpr decltype(auto) invokeMember(F f, Obj &&obj, Args &&...args)
+{
+    using class_t = typename member_pointer_class<F>::type;
+    if constexpr (std::is_member_function_pointer_v<F>)
+        return (memberTarget<class_t>(std::forward<Obj>(obj)).*f)(std::forward<Args>(args)...);
+    else
+        return memberTarget<class_t>(std::forward<Obj>(obj)).*f;
+}
+
+template <typename F, typename... Args> constexpr decltype(auto) invoke(F &&f, Args &&...args)
+{
+    if constexpr (std::is_member_pointer_v<std::decay_t<F>>)
+        return invokeMember(f, std::forward<Args>(args)...);
+    else
+        return std::forward<F>(f)(std::forward<Args>(args)...);
+}
+
+// A callable known at compile time, such as the F of bind_front<F>. Member pointers are applied
+// as constants here rather than passed to invokeMember as data, so the call is a direct one.
+template <auto Func> struct static_target
+{
+    template <typename... Args> constexpr decltype(auto) operator()(Args &&...args) const
+    {
+        if constexpr (std::is_member_pointer_v<decltype(Func)>)
+            return member(std::forward<Args>(args)...);
+        else
+            return detail::invoke(Func, std::forward<Args>(args)...);
+    }
+
+    template <typename Obj, typename... Args>
+    static constexpr decltype(auto) member(Obj &&obj, Args &&...args)
+    {
+        using class_t = typename member_pointer_class<decltype(Func)>::type;
+        if constexpr (std::is_member_function_pointer_v<decltype(Func)>)
+            return (memberTarget<class_t>(std::forward<Obj>(obj)).*Func)(
+                std::forward<Args>(args)...);
+        else
+            return memberTarget<class_t>(std::forward<Obj>(obj)).*Func;
+    }
+};
+
+/*
+ * Calls f with the bound arguments in front of (or behind) the call arguments. The bound tuple
+ * is passed on with the value category of the binder: a binder called as an lvalue hands its
+ * stored arguments over as lvalues, straight out of the tuple, and one called as an rvalue
+ * moves them out, which is how move-only bound state gets consumed. Call arguments are always
+ * perfectly forwarded.
+ *
+ * The tuple is expanded here rather than through std::apply, whose extra layers of calls are
+ * enough to stop GCC at -O2 inlining the target into the binder's caller.
+ */
+template <bool BoundInFront, typename F, typename Tuple, size_t... I, typename... CallParams>
+constexpr decltype(auto) invokeBoundIndexed(F &&f, Tuple &&bound, std::index_sequence<I...>,
+                                            CallParams &&...callArgs)
+{
+    if constexpr (BoundInFront)
+        return detail::invoke(std::forward<F>(f), std::get<I>(std::forward<Tuple>(bound))...,
+                              std::forward<CallParams>(callArgs)...);
+    else
+        return detail::invoke(std::forward<F>(f), std::forward<CallParams>(callArgs)...,
+                              std::get<I>(std::forward<Tuple>(bound))...);
+}
+
+template <bool BoundInFront, typename F, typename Tuple, typename... CallParams>
+constexpr decltype(auto) invokeBound(F &&f, Tuple &&bound, CallParams &&...callArgs)
+{
+    using indices = std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<Tuple>>>;
+    return invokeBoundIndexed<BoundInFront>(std::forward<F>(f), std::forward<Tuple>(bound),
+                                            indices{}, std::forward<CallParams>(callArgs)...);
+}
+
+/*
+ * Like std::bind_front, the binders own decayed copies of the callable and the bound
+ * arguments, and have call operators for each of &, const &, && and const &&, so invoking one
+ * holding a std::string or std::vector neither copies nor allocates.
+ */
 template <typename Func, typename... FrontParams> class FrontBinder
 {
     Func func;
     std::tuple<FrontParams...> frontArgsTuple;
 
   public:
-    explicit FrontBinder(Func &&f, FrontParams &&...frontArgs)
-        : func(std::move(f)), frontArgsTuple(std::move(frontArgs)...)
+    template <typename F, typename... Ps,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, FrontBinder>>>
+    constexpr explicit FrontBinder(F &&f, Ps &&...frontArgs)
+        : func(std::forward<F>(f)), frontArgsTuple(std::forward<Ps>(frontArgs)...)
+    {
+    }
+
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) &
+    {
+        return invokeBound<true>(func, frontArgsTuple, std::forward<BackParams>(backArgs)...);
+    }
+
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) const &
     {
+        return invokeBound<true>(func, frontArgsTuple, std::forward<BackParams>(backArgs)...);
     }
 
-    template <typename... BackParams> auto operator()(BackParams &&...backArgs)
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) &&
     {
-        return std::apply(
-            [this](auto... args) { return std::invoke(func, args...); },
-            std::move(std::tuple_cat(frontArgsTuple, std::forward_as_tuple(backArgs...))));
+        return invokeBound<true>(std::move(func), std::move(frontArgsTuple),
+                                 std::forward<BackParams>(backArgs)...);
     }
 
-    template <typename... BackParams> auto operator()(BackParams &&...backArgs) const
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) const &&
     {
-        return std::apply(
-            [this](auto... args) { return std::invoke(func, args...); },
-            std::move(std::tuple_cat(frontArgsTuple, std::forward_as_tuple(backArgs...))));
+        return invokeBound<true>(std::move(func), std::move(frontArgsTuple),
+                                 std::forward<BackParams>(backArgs)...);
     }
 };
 
@@ -59,23 +182,119 @@ template <typename Func, typename... BackParams> class BackBinder
     std::tuple<BackParams...> backArgsTuple;
 
   public:
-    explicit BackBinder(Func &&f, BackParams &&...backArgs)
-        : func(std::move(f)), backArgsTuple(std::move(backArgs)...)
+    template <typename F, typename... Ps,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, BackBinder>>>
+    constexpr explicit BackBinder(F &&f, Ps &&...backArgs)
+        : func(std::forward<F>(f)), backArgsTuple(std::forward<Ps>(backArgs)...)
+    {
+    }
+
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) &
+    {
+        return invokeBound<false>(func, backArgsTuple, std::forward<FrontParams>(frontArgs)...);
+    }
+
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) const &
+    {
+        return invokeBound<false>(func, backArgsTuple, std::forward<FrontParams>(frontArgs)...);
+    }
+
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) &&
+    {
+        return invokeBound<false>(std::move(func), std::move(backArgsTuple),
+                                  std::forward<FrontParams>(frontArgs)...);
+    }
+
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) const &&
+    {
+        return invokeBound<false>(std::move(func), std::move(backArgsTuple),
+                                  std::forward<FrontParams>(frontArgs)...);
+    }
+};
+
+// The bind_front<F> / bind_back<F> binders: the callable is a template argument, so it is
+// called directly rather than through a stored (member) function pointer.
+template <auto Func, typename... FrontParams> class StaticFrontBinder
+{
+    std::tuple<FrontParams...> frontArgsTuple;
+
+  public:
+    template <typename... Ps>
+    constexpr explicit StaticFrontBinder(std::in_place_t, Ps &&...frontArgs)
+        : frontArgsTuple(std::forward<Ps>(frontArgs)...)
+    {
+    }
+
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) &
+    {
+        return invokeBound<true>(static_target<Func>{}, frontArgsTuple,
+                                 std::forward<BackParams>(backArgs)...);
+    }
+
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) const &
+    {
+        return invokeBound<true>(static_target<Func>{}, frontArgsTuple,
+                                 std::forward<BackParams>(backArgs)...);
+    }
+
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) &&
+    {
+        return invokeBound<true>(static_target<Func>{}, std::move(frontArgsTuple),
+                                 std::forward<BackParams>(backArgs)...);
+    }
+
+    template <typename... BackParams>
+    constexpr decltype(auto) operator()(BackParams &&...backArgs) const &&
+    {
+        return invokeBound<true>(static_target<Func>{}, std::move(frontArgsTuple),
+                                 std::forward<BackParams>(backArgs)...);
+    }
+};
+
+template <auto Func, typename... BackParams> class StaticBackBinder
+{
+    std::tuple<BackParams...> backArgsTuple;
+
+  public:
+    template <typename... Ps>
+    constexpr explicit StaticBackBinder(std::in_place_t, Ps &&...backArgs)
+        : backArgsTuple(std::forward<Ps>(backArgs)...)
+    {
+    }
+
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) &
+    {
+        return invokeBound<false>(static_target<Func>{}, backArgsTuple,
+                                  std::forward<FrontParams>(frontArgs)...);
+    }
+
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) const &
     {
+        return invokeBound<false>(static_target<Func>{}, backArgsTuple,
+                                  std::forward<FrontParams>(frontArgs)...);
     }
 
-    template <typename... FrontParams> auto operator()(FrontParams &&...frontArgs)
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) &&
     {
-        return std::apply(
-            [this](auto... args) { return std::invoke(func, args...); },
-            std::move(std::tuple_cat(std::forward_as_tuple(frontArgs...), backArgsTuple)));
+        return invokeBound<false>(static_target<Func>{}, std::move(backArgsTuple),
+                                  std::forward<FrontParams>(frontArgs)...);
     }
 
-    template <typename... FrontParams> auto operator()(FrontParams &&...frontArgs) const
+    template <typename... FrontParams>
+    constexpr decltype(auto) operator()(FrontParams &&...frontArgs) const &&
     {
-        return std::apply(
-            [this](auto... args) { return std::invoke(func, args...); },
-            std::move(std::tuple_cat(std::forward_as_tuple(frontArgs...), backArgsTuple)));
+        return invokeBound<false>(static_target<Func>{}, std::move(backArgsTuple),
+                                  std::forward<FrontParams>(frontArgs)...);
     }
 };
 } // namespace detail
@@ -85,10 +304,11 @@ template <typename Func, typename... BackParams> class BackBinder
 using std::bind_front;
 #else
 /** Temporary replacement for std::bind_front, which is only available in C++20 */
-template <typename Func, typename... Params> auto bind_front(Func &&func, Params &&...frontParams)
+template <typename Func, typename... Params>
+constexpr auto bind_front(Func &&func, Params &&...frontParams)
 {
-    return detail::FrontBinder<Func, Params...>{std::forward<Func>(func),
-                                                std::forward<Params>(frontParams)...};
+    return detail::FrontBinder<std::decay_t<Func>, std::decay_t<Params>...>{
+        std::forward<Func>(func), std::forward<Params>(frontParams)...};
 }
 #endif
 
@@ -96,12 +316,103 @@ template <typename Func, typename... Params> auto bind_front(Func &&func, Params
 using std::bind_back;
 #else
 /** Temporary replacement for std::bind_back, which is only available in C++23 */
-template <typename Func, typename... Params> auto bind_back(Func &&func, Params &&...backParams)
+template <typename Func, typename... Params>
+constexpr auto bind_back(Func &&func, Params &&...backParams)
+{
+    return detail::BackBinder<std::decay_t<Func>, std::decay_t<Params>...>{
+        std::forward<Func>(func), std::forward<Params>(backParams)...};
+}
+#endif
+
+#if !defined(__cpp_lib_bind_front) || __cpp_lib_bind_front < 202306L
+/**
+ * bind_front with the callable as a template argument, as in C++26. Binding
+ * `bind_front<&Voice::setCutoff>(&voice)` stores only the object pointer, and every call is a
+ * direct call to Voice::setCutoff which the compiler can inline, rather than an indirect call
+ * through a pointer-to-member held in the binder. Like the runtime form it stores copies of the
+ * bound arguments, so bind an object by pointer or std::ref, not by value.
+ */
+template <auto Func, typename... Params> constexpr auto bind_front(Params &&...frontParams)
+{
+    return detail::StaticFrontBinder<Func, std::decay_t<Params>...>{
+        std::in_place, std::forward<Params>(frontParams)...};
+}
+#endif
+
+#if !defined(__cpp_lib_bind_back) || __cpp_lib_bind_back < 202306L
+/** bind_back with the callable as a template argument; see bind_front<Func> */
+template <auto Func, typename... Params> constexpr auto bind_back(Params &&...backParams)
 {
-    return detail::BackBinder<Func, Params...>{std::forward<Func>(func),
-                                               std::forward<Params>(backParams)...};
+    return detail::StaticBackBinder<Func, std::decay_t<Params>...>{
+        std::in_place, std::forward<Params>(backParams)...};
 }
 #endif
+
+template <typename Sig> class delegate;
+
+/**
+ * A non-owning callback to a member function of a particular object, or to a free function,
+ * fixed at compile time. It is two pointers, the object and a stub instantiated for that exact
+ * function, so it is trivially copyable, never allocates, and calls through a single indirect
+ * call to the stub, which calls the target directly. Two delegates compare equal when they call
+ * the same function on the same object, so they can be found again to disconnect them.
+ *
+ * The object must outlive the delegate. Calling an empty delegate throws
+ * std::bad_function_call.
+ *
+ * ```
+ * auto d = sst::cpputils::delegate<void(float)>::create<&Voice::setCutoff>(voice);
+ * d(0.5f);
+ * ```
+ */
+template <typename R, typename... Args> class delegate<R(Args...)>
+{
+    using stub_t = R (*)(void *, Args...);
+
+  public:
+    delegate() = default;
+
+    // Calls (obj.*Func)(args...), or Func(obj, args...) for a free function taking the object
+    template <auto Func, typename T> static delegate create(T &obj) noexcept
+    {
+        return delegate(const_cast<void *>(static_cast<const void *>(std::addressof(obj))),
+                        &objectStub<Func, T>);
+    }
+
+    // Calls Func(args...)
+    template <auto Func> static delegate create() noexcept
+    {
+        return delegate(nullptr, &freeStub<Func>);
+    }
+
+    R operator()(Args... args) const { return stub(obj, std::forward<Args>(args)...); }
+
+    explicit operator bool() const noexcept { return stub != &emptyStub; }
+
+    friend bool operator==(const delegate &a, const delegate &b) noexcept
+    {
+        return a.obj == b.obj && a.stub == b.stub;
+    }
+    friend bool operator!=(const delegate &a, const delegate &b) noexcept { return !(a == b); }
+
+  private:
+    delegate(void *o, stub_t s) : obj(o), stub(s) {}
+
+    static R emptyStub(void *, Args...) { throw std::bad_function_call(); }
+
+    template <auto Func, typename T> static R objectStub(void *o, Args... args)
+    {
+        return static_cast<R>(std::invoke(Func, *static_cast<T *>(o), std::forward<Args>(args)...));
+    }
+    template <auto Func> static R freeStub(void *, Args... args)
+    {
+        return static_cast<R>(std::invoke(Func, std::forward<Args>(args)...));
+    }
+
+    void *obj{nullptr};
+    stub_t stub{&emptyStub};
+};
+
 } // namespace cpputils
 } // namespace sst
 
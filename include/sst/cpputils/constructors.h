@@ -18,33 +18,148 @@
 #define INCLUDE_SST_CPPUTILS_CONSTRUCTORS_H
 
 #include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "detail/platform.h"
+
+/*
+ * Arrays up to this many elements are built from a single braced initializer over an index
+ * pack, larger ones element by element in a loop. The pack costs the compiler time and memory
+ * for every element (and every make_array_lambda index is a separate instantiation of the
+ * maker), which for 4096 and more elements runs to many seconds and gigabytes.
+ */
+#ifndef SST_CPPUTILS_MAKE_ARRAY_PACK_LIMIT
+#define SST_CPPUTILS_MAKE_ARRAY_PACK_LIMIT 256
+#endif
 
 namespace sst::cpputils
 {
 namespace detail
 {
+inline constexpr size_t makeArrayPackLimit = SST_CPPUTILS_MAKE_ARRAY_PACK_LIMIT;
+
+/*
+ * The index handed to the constructor by the large make_array_bind_*_index path. Unlike the
+ * compile-time index of the pack path a runtime size_t would be a narrowing error in T{..., i}
+ * against an int parameter, so this converts to any arithmetic type instead.
+ */
+struct array_index
+{
+    size_t value;
+    template <typename I, typename = std::enable_if_t<std::is_arithmetic_v<I>>>
+    constexpr operator I() const
+    {
+        return static_cast<I>(value);
+    }
+};
+
+// Default construct then assign in a loop, which is still constexpr
+template <typename T, size_t N, typename Build>
+constexpr std::array<T, N> make_array_loop(Build &build)
+{
+    std::array<T, N> res{};
+    for (size_t i = 0; i < N; ++i)
+        res[i] = build(i);
+    return res;
+}
+
+// Construct each element in place, for types which cannot be default constructed, destroying
+// those already built if one throws. The result is moved out, so T needs to be movable.
+template <typename T, size_t N, typename Build>
+std::array<T, N> make_array_uninitialized(Build &build)
+{
+    static_assert(std::is_move_constructible_v<T>, "non movable types take make_array_elided");
+    union storage_t
+    {
+        std::array<T, N> arr;
+        storage_t() {}
+        ~storage_t() {}
+    } st;
+
+    struct guard_t
+    {
+        storage_t &st;
+        size_t built{0};
+        ~guard_t()
+        {
+            while (built > 0)
+                st.arr[--built].~T();
+        }
+    } guard{st};
+
+    for (; guard.built < N; ++guard.built)
+        ::new (static_cast<void *>(st.arr.data() + guard.built)) T(build(guard.built));
+    return std::move(st.arr);
+}
+
+// One initializer per element, each a prvalue from build, so copy elision constructs them in
+// the returned array; the only way to return types which can neither be moved nor assigned.
+// build takes a plain size_t, so it is instantiated once, but this compiles slowly for large N.
+template <typename T, size_t... Is, typename Build>
+constexpr std::array<T, sizeof...(Is)> make_array_elided(std::index_sequence<Is...>, Build &build)
+{
+    return {build(Is)...};
+}
+
+/*
+ * Only trivially default constructible types take the loop at runtime. For anything else the
+ * default constructor may have side effects or real cost, so each element is built once from
+ * its arguments instead and moved into the result. Constant evaluation cannot placement new,
+ * so there every default constructible type takes the loop. Types which can be neither
+ * assigned nor moved, such as std::atomic or anything holding a std::mutex, can only be built
+ * in the returned array by a full initializer list, as the small array path does.
+ */
+template <typename T, size_t N, typename Build>
+constexpr std::array<T, N> make_array_large(Build &&build)
+{
+    constexpr bool canLoop = std::is_default_constructible_v<T> && std::is_move_assignable_v<T>;
+    constexpr bool canMove = std::is_move_constructible_v<T>;
+    if constexpr (canLoop && (std::is_trivially_default_constructible_v<T> || !canMove))
+    {
+        return make_array_loop<T, N>(build);
+    }
+    else if constexpr (canLoop)
+    {
+        if (!SST_CPPUTILS_HAS_CONSTANT_EVALUATED || is_constant_evaluated())
+            return make_array_loop<T, N>(build);
+        return make_array_uninitialized<T, N>(build);
+    }
+    else if constexpr (canMove)
+    {
+        return make_array_uninitialized<T, N>(build);
+    }
+    else
+    {
+        return make_array_elided<T>(std::make_index_sequence<N>{}, build);
+    }
+}
+
 template <typename T, size_t... Is, typename... Args>
-std::array<T, sizeof...(Is)> make_array_helper(std::index_sequence<Is...>, Args &&...args)
+constexpr std::array<T, sizeof...(Is)> make_array_helper(std::index_sequence<Is...>,
+                                                         Args &&...args)
 {
     return {(static_cast<void>(Is), T{std::forward<Args>(args)...})...};
 }
 
 template <typename T, size_t... Is, typename... Args>
-std::array<T, sizeof...(Is)> make_array_helper_last_index(std::index_sequence<Is...>,
-                                                          Args &&...args)
+constexpr std::array<T, sizeof...(Is)> make_array_helper_last_index(std::index_sequence<Is...>,
+                                                                    Args &&...args)
 {
     return {(static_cast<void>(Is), T{std::forward<Args>(args)..., Is})...};
 }
 
 template <typename T, size_t... Is, typename... Args>
-std::array<T, sizeof...(Is)> make_array_helper_first_index(std::index_sequence<Is...>,
-                                                           Args &&...args)
+constexpr std::array<T, sizeof...(Is)> make_array_helper_first_index(std::index_sequence<Is...>,
+                                                                     Args &&...args)
 {
     return {(static_cast<void>(Is), T{Is, std::forward<Args>(args)...})...};
 }
 
 template <typename T, size_t... Is, typename Maker>
-std::array<T, sizeof...(Is)> make_array_lambda(std::index_sequence<Is...>, Maker &&maker)
+constexpr std::array<T, sizeof...(Is)> make_array_lambda(std::index_sequence<Is...>, Maker &&maker)
 {
     return {T{maker(std::integral_constant<size_t, Is>())}...};
 }
@@ -66,24 +181,52 @@ std::array<T, sizeof...(Is)> make_array_lambda(std::index_sequence<Is...>, Maker
  * std::array<Foo, 18> foo{sst::cpputils::make_array_bind_first_idnex<Foo, 18>("test")};
  *
  * will construct with the a bound to 0, 1, 2, ...
+ *
+ * Above SST_CPPUTILS_MAKE_ARRAY_PACK_LIMIT elements (256 by default) the array is filled in a
+ * loop instead, which keeps compile time flat for tables of thousands of elements. Each
+ * element is still built exactly once from its arguments, but then moved once into the
+ * result. The maker of make_array_lambda receives a plain size_t rather than a
+ * std::integral_constant. Trivially default constructible types, and any default
+ * constructible type in a constant expression, are instead default constructed and assigned.
+ * Types which can be neither moved nor assigned (std::atomic, a struct holding a std::mutex)
+ * still work at any size, but are built from a full initializer list, so compile as slowly
+ * as before.
+ *
+ * All of these are constexpr, so with a constexpr constructor (or maker, which may be a
+ * bind_front or bind_back) the table is built by the compiler, with no static initialization:
+ *
+ * static constexpr auto coeffs{sst::cpputils::make_array_lambda<float, 64>(computeCoeff)};
  */
-template <typename T, size_t N, typename... Args> std::array<T, N> make_array(Args &&...args)
+template <typename T, size_t N, typename... Args>
+constexpr std::array<T, N> make_array(Args &&...args)
 {
-    return detail::make_array_helper<T>(std::make_index_sequence<N>{}, std::forward<Args>(args)...);
+    if constexpr (N <= detail::makeArrayPackLimit)
+        return detail::make_array_helper<T>(std::make_index_sequence<N>{},
+                                            std::forward<Args>(args)...);
+    else
+        return detail::make_array_large<T, N>([&](size_t) { return T{args...}; });
 }
 
 template <typename T, size_t N, typename... Args>
-std::array<T, N> make_array_bind_last_index(Args &&...args)
+constexpr std::array<T, N> make_array_bind_last_index(Args &&...args)
 {
-    return detail::make_array_helper_last_index<T>(std::make_index_sequence<N>{},
-                                                   std::forward<Args>(args)...);
+    if constexpr (N <= detail::makeArrayPackLimit)
+        return detail::make_array_helper_last_index<T>(std::make_index_sequence<N>{},
+                                                       std::forward<Args>(args)...);
+    else
+        return detail::make_array_large<T, N>(
+            [&](size_t i) { return T{args..., detail::array_index{i}}; });
 }
 
 template <typename T, size_t N, typename... Args>
-std::array<T, N> make_array_bind_first_index(Args &&...args)
+constexpr std::array<T, N> make_array_bind_first_index(Args &&...args)
 {
-    return detail::make_array_helper_first_index<T>(std::make_index_sequence<N>{},
-                                                    std::forward<Args>(args)...);
+    if constexpr (N <= detail::makeArrayPackLimit)
+        return detail::make_array_helper_first_index<T>(std::make_index_sequence<N>{},
+                                                        std::forward<Args>(args)...);
+    else
+        return detail::make_array_large<T, N>(
+            [&](size_t i) { return T{detail::array_index{i}, args...}; });
 }
 
 /** Returns an array of size N, with each value initialized by calling the maker lambda with
@@ -91,7 +234,11 @@ std::array<T, N> make_array_bind_first_index(Args &&...args)
 template <typename T, size_t N, typename Maker>
 constexpr std::array<T, N> make_array_lambda(Maker &&maker)
 {
-    return detail::make_array_lambda<T>(std::make_index_sequence<N>{}, std::forward<Maker>(maker));
+    if constexpr (N <= detail::makeArrayPackLimit)
+        return detail::make_array_lambda<T>(std::make_index_sequence<N>{},
+                                            std::forward<Maker>(maker));
+    else
+        return detail::make_array_large<T, N>([&](size_t i) { return T{maker(i)}; });
 }
 } // namespace sst::cpputils
 
@@ -0,0 +1,235 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_DENSE_BITSET_SET_H
+#define INCLUDE_SST_CPPUTILS_DENSE_BITSET_SET_H
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+
+#include "detail/platform.h"
+
+namespace sst
+{
+namespace cpputils
+{
+
+/*
+ * A set of the integers [0, N), one bit each, for small key domains like MIDI notes (N = 128),
+ * channels or voice slots. insert, erase and contains are a shift and a mask; size is a
+ * popcount per 64 bit word; iteration visits members in increasing order, jumping straight
+ * from one set bit to the next; and union, intersection and difference work a word at a time.
+ *
+ * It has a contains member, so sst::cpputils::contains dispatches to it. Keys outside [0, N)
+ * are never contained, and inserting one is an error.
+ *
+ * ```
+ * sst::cpputils::dense_bitset_set<128> held;
+ * held.insert(60);
+ * for (auto note : held)
+ *     releaseNote(note);
+ * ```
+ */
+template <size_t N> class dense_bitset_set
+{
+    static constexpr size_t nWords = (N + 63) / 64;
+
+  public:
+    using key_type = size_t;
+    using value_type = size_t;
+    using size_type = size_t;
+
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const size_t *;
+        using reference = size_t;
+
+        iterator() = default;
+
+        size_t operator*() const { return word * 64 + (size_t)detail::countr_zero(bits); }
+        iterator &operator++()
+        {
+            bits &= bits - 1; // clear the lowest set bit
+            advance();
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            auto r = *this;
+            ++*this;
+            return r;
+        }
+        bool operator==(const iterator &o) const { return word == o.word && bits == o.bits; }
+        bool operator!=(const iterator &o) const { return !(*this == o); }
+
+      private:
+        friend class dense_bitset_set;
+        iterator(const uint64_t *w, size_t idx) : words(w), word(idx)
+        {
+            bits = word < nWords ? words[word] : 0;
+            advance();
+        }
+        // move to the next non empty word, if this one is exhausted
+        void advance()
+        {
+            while (bits == 0 && word < nWords)
+            {
+                ++word;
+                bits = word < nWords ? words[word] : 0;
+            }
+        }
+
+        const uint64_t *words{nullptr};
+        size_t word{nWords};
+        uint64_t bits{0};
+    };
+    using const_iterator = iterator;
+
+    constexpr dense_bitset_set() = default;
+    dense_bitset_set(std::initializer_list<size_t> il)
+    {
+        for (auto k : il)
+            insert(k);
+    }
+
+    static constexpr size_type capacity() { return N; }
+
+    // Returns true if the key was not already present
+    constexpr bool insert(size_t k)
+    {
+        assert(k < N);
+        auto m = mask(k);
+        auto was = words_[k / 64] & m;
+        words_[k / 64] |= m;
+        return !was;
+    }
+
+    constexpr size_type erase(size_t k)
+    {
+        if (k >= N)
+            return 0;
+        auto m = mask(k);
+        auto was = words_[k / 64] & m;
+        words_[k / 64] &= ~m;
+        return was ? 1 : 0;
+    }
+
+    constexpr bool contains(size_t k) const { return k < N && (words_[k / 64] & mask(k)); }
+    constexpr size_type count(size_t k) const { return contains(k) ? 1 : 0; }
+
+    size_type size() const
+    {
+        size_type res{0};
+        for (auto w : words_)
+            res += (size_type)detail::popcount(w);
+        return res;
+    }
+    constexpr bool empty() const
+    {
+        for (auto w : words_)
+            if (w)
+                return false;
+        return true;
+    }
+    constexpr void clear()
+    {
+        for (auto &w : words_)
+            w = 0;
+    }
+
+    iterator begin() const { return iterator(words_.data(), 0); }
+    iterator end() const { return iterator(words_.data(), nWords); }
+    iterator find(size_t k) const
+    {
+        if (!contains(k))
+            return end();
+        iterator it(words_.data(), k / 64);
+        it.bits = words_[k / 64] & ~(mask(k) - 1); // drop the bits below k
+        return it;
+    }
+
+    // Word-parallel set algebra
+    constexpr dense_bitset_set &operator|=(const dense_bitset_set &o)
+    {
+        for (size_t i = 0; i < nWords; ++i)
+            words_[i] |= o.words_[i];
+        return *this;
+    }
+    constexpr dense_bitset_set &operator&=(const dense_bitset_set &o)
+    {
+        for (size_t i = 0; i < nWords; ++i)
+            words_[i] &= o.words_[i];
+        return *this;
+    }
+    constexpr dense_bitset_set &operator-=(const dense_bitset_set &o)
+    {
+        for (size_t i = 0; i < nWords; ++i)
+            words_[i] &= ~o.words_[i];
+        return *this;
+    }
+    friend constexpr dense_bitset_set operator|(dense_bitset_set a, const dense_bitset_set &b)
+    {
+        return a |= b;
+    }
+    friend constexpr dense_bitset_set operator&(dense_bitset_set a, const dense_bitset_set &b)
+    {
+        return a &= b;
+    }
+    friend constexpr dense_bitset_set operator-(dense_bitset_set a, const dense_bitset_set &b)
+    {
+        return a -= b;
+    }
+    constexpr bool intersects(const dense_bitset_set &o) const
+    {
+        for (size_t i = 0; i < nWords; ++i)
+            if (words_[i] & o.words_[i])
+                return true;
+        return false;
+    }
+
+    friend constexpr bool operator==(const dense_bitset_set &a, const dense_bitset_set &b)
+    {
+        for (size_t i = 0; i < nWords; ++i)
+            if (a.words_[i] != b.words_[i])
+                return false;
+        return true;
+    }
+    friend constexpr bool operator!=(const dense_bitset_set &a, const dense_bitset_set &b)
+    {
+        return !(a == b);
+    }
+
+    // The underlying 64 bit words, bit k % 64 of word k / 64 being key k.
+    constexpr const std::array<uint64_t, nWords> &words() const { return words_; }
+
+  private:
+    static constexpr uint64_t mask(size_t k) { return uint64_t(1) << (k % 64); }
+
+    std::array<uint64_t, nWords> words_{};
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_DENSE_BITSET_SET_H
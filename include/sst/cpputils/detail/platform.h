@@ -0,0 +1,142 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_DETAIL_PLATFORM_H
+#define INCLUDE_SST_CPPUTILS_DETAIL_PLATFORM_H
+
+/*
+ * Compiler and instruction set detection shared by the headers which carry hand written
+ * kernels. Everything is decided at compile time from the target flags; there is no runtime
+ * CPU dispatch. Each kernel keeps a portable scalar path so none of these are required.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SST_CPPUTILS_SIMD_SSE2 1
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SST_CPPUTILS_SIMD_AVX2 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SST_CPPUTILS_SIMD_NEON 1
+#if defined(__aarch64__) || defined(_M_ARM64)
+// AArch64 adds the across-vector reductions and 64 bit lane compares.
+#define SST_CPPUTILS_SIMD_NEON64 1
+#endif
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+// __builtin_is_constant_evaluated is the C++17 spelling of std::is_constant_evaluated
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define SST_CPPUTILS_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+#if !defined(SST_CPPUTILS_HAS_CONSTANT_EVALUATED)
+#if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) ||                                 \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define SST_CPPUTILS_HAS_CONSTANT_EVALUATED 1
+#else
+#define SST_CPPUTILS_HAS_CONSTANT_EVALUATED 0
+#endif
+#endif
+
+namespace sst
+{
+namespace cpputils
+{
+namespace detail
+{
+// True while being evaluated in a constant expression, so runtime-only fast paths (SIMD
+// intrinsics, memchr) can step aside. Always false where the compiler cannot tell us.
+constexpr bool is_constant_evaluated() noexcept
+{
+#if SST_CPPUTILS_HAS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+// The line size of every x86 and most ARM cores; only used to space prefetches.
+constexpr size_t cache_line_bytes{64};
+
+// Hint to the CPU that we will read from this address shortly. A no-op where we have no intrinsic.
+inline void prefetch_for_read(const void *p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char *>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+// Our own C++17 stand-ins for std::countr_zero and std::popcount on 64 bit words.
+// countr_zero(0) is 64.
+inline int countr_zero(uint64_t x)
+{
+    if (x == 0)
+        return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return (int)idx;
+#else
+    int n{0};
+    while (!(x & 1))
+    {
+        x >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline int popcount(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    // the MSVC intrinsic needs the POPCNT instruction, which we can't assume
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+} // namespace detail
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_DETAIL_PLATFORM_H
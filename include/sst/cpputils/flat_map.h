@@ -0,0 +1,595 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_FLAT_MAP_H
+#define INCLUDE_SST_CPPUTILS_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "detail/platform.h"
+
+namespace sst
+{
+namespace cpputils
+{
+
+/**
+ * How a flat_set or flat_map lays out its search index.
+ *
+ * - sorted: the keys are one sorted array, searched with a branchless binary search. Inserts
+ *   and erases are O(n) moves.
+ * - eytzinger: additionally keeps a copy of the keys in breadth-first (Eytzinger) order,
+ *   where the children of slot k are 2k and 2k+1. The top levels of the implicit tree share
+ *   cache lines and the next levels can be prefetched, so lookups in large tables touch far
+ *   fewer lines. Every mutation rebuilds the copy in O(n), so use it for read-mostly tables.
+ */
+enum class flat_layout
+{
+    sorted,
+    eytzinger
+};
+
+#ifndef DOXYGEN
+namespace detail
+{
+/*
+ * The sorted key array shared by flat_set and flat_map, plus the optional Eytzinger copy.
+ * lower_bound returns a position in the sorted array under either layout.
+ */
+template <typename Key, typename Compare, flat_layout Layout> class flat_index
+{
+  public:
+    explicit flat_index(const Compare &c = Compare()) : comp(c) {}
+
+    size_t lower_bound(const Key &key) const
+    {
+        auto n = keys.size();
+        if constexpr (Layout == flat_layout::eytzinger)
+        {
+            // Descend the implicit tree; prefetching four levels down covers the 16
+            // descendants we might visit, which sit in one cache line for small keys.
+            const Key *e = eytKeys.data();
+            size_t k{1};
+            while (k <= n)
+            {
+                if (16 * k <= n)
+                    prefetch_for_read(e + 16 * k);
+                k = 2 * k + static_cast<size_t>(comp(e[k], key));
+            }
+            // undo the trailing right turns, plus the last left one, to find the answer
+            k >>= countr_zero(~static_cast<uint64_t>(k)) + 1;
+            return k == 0 ? n : eytToSorted[k];
+        }
+        else
+        {
+            if (n == 0)
+                return 0;
+            // Branchless binary search: the loop trip count only depends on n, and the
+            // select compiles to a conditional move. Prefetch both candidate midpoints of
+            // the next round.
+            const Key *base = keys.data();
+            while (n > 1)
+            {
+                auto half = n / 2;
+                prefetch_for_read(base + half / 2);
+                prefetch_for_read(base + half + half / 2);
+                base = comp(base[half], key) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<size_t>(base - keys.data()) + comp(*base, key);
+        }
+    }
+
+    // Position of key, or keys.size() if absent
+    size_t find(const Key &key) const
+    {
+        auto i = lower_bound(key);
+        return (i < keys.size() && !comp(key, keys[i])) ? i : keys.size();
+    }
+
+    /*
+     * The Eytzinger copy of n sorted keys, read through key(i), built aside so that a throwing
+     * copy or allocation leaves the index untouched. commit() then swaps it in with the new
+     * sorted keys, which cannot throw.
+     */
+    struct staged
+    {
+        std::vector<Key> eytKeys;
+        std::vector<size_t> eytToSorted;
+    };
+    template <typename KeyAt> static staged stage(size_t n, KeyAt &&key)
+    {
+        staged s;
+        if constexpr (Layout == flat_layout::eytzinger)
+        {
+            if (n == 0)
+                return s;
+            // slot 0 is unused, it only holds a copy so Key needn't be default constructible
+            s.eytKeys.resize(n + 1, key(0));
+            s.eytToSorted.resize(n + 1, 0);
+            size_t i{0};
+            fill(s, key, i, 1);
+        }
+        return s;
+    }
+    void commit(std::vector<Key> &sortedKeys, staged &s) noexcept
+    {
+        keys.swap(sortedKeys);
+        eytKeys.swap(s.eytKeys);
+        eytToSorted.swap(s.eytToSorted);
+    }
+
+    void rebuild()
+    {
+        if constexpr (Layout == flat_layout::eytzinger)
+        {
+            auto s = stage(keys.size(), [this](size_t i) -> const Key & { return keys[i]; });
+            eytKeys.swap(s.eytKeys);
+            eytToSorted.swap(s.eytToSorted);
+        }
+    }
+
+    void clear()
+    {
+        keys.clear();
+        eytKeys.clear();
+        eytToSorted.clear();
+    }
+
+    std::vector<Key> keys;
+    Compare comp;
+
+  private:
+    // An in-order walk of the implicit tree visits the sorted keys in order.
+    template <typename KeyAt> static void fill(staged &s, KeyAt &key, size_t &i, size_t k)
+    {
+        if (k < s.eytKeys.size())
+        {
+            fill(s, key, i, 2 * k);
+            s.eytKeys[k] = key(i);
+            s.eytToSorted[k] = i;
+            ++i;
+            fill(s, key, i, 2 * k + 1);
+        }
+    }
+
+    std::vector<Key> eytKeys;
+    std::vector<size_t> eytToSorted;
+};
+
+/*
+ * The order in which to merge sorted, unique keys with n sorted (stably, so duplicates keep
+ * their order) new keys read through incoming(j), dropping repeats so the first wins. Entry
+ * c < keys.size() is keys[c], otherwise new key c - keys.size(). Only the comparator runs
+ * here, so the bulk inserts can work out the merge before moving anything.
+ */
+template <typename Key, typename Compare, typename KeyAt>
+std::vector<size_t> flat_merge_plan(const std::vector<Key> &keys, size_t n, KeyAt &&incoming,
+                                    const Compare &comp)
+{
+    std::vector<size_t> plan;
+    plan.reserve(keys.size() + n);
+    const Key *last{nullptr};
+    auto take = [&](const Key &k, size_t code) {
+        if (last && !comp(*last, k))
+            return;
+        plan.push_back(code);
+        last = &k;
+    };
+    size_t i{0};
+    for (size_t j = 0; j < n; ++j)
+    {
+        const Key &k = incoming(j);
+        for (; i < keys.size() && !comp(k, keys[i]); ++i)
+            take(keys[i], i);
+        take(k, keys.size() + j);
+    }
+    for (; i < keys.size(); ++i)
+        take(keys[i], i);
+    return plan;
+}
+} // namespace detail
+#endif // DOXYGEN
+
+/*
+ * A set stored as a sorted contiguous array. Iteration is in sorted order and lookups are a
+ * branchless binary search (or an Eytzinger search, see flat_layout) over keys which sit next
+ * to each other in memory, rather than a pointer chase through tree nodes. Inserts and
+ * erases move elements, and invalidate iterators, like a std::vector.
+ *
+ * contains(), find() and the sst::cpputils::contains dispatch all use the fast search.
+ */
+template <typename Key, typename Compare = std::less<Key>,
+          flat_layout Layout = flat_layout::sorted>
+class flat_set
+{
+  public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using size_type = size_t;
+    using iterator = typename std::vector<Key>::const_iterator;
+    using const_iterator = iterator;
+
+    flat_set() = default;
+    explicit flat_set(const Compare &c) : idx_(c) {}
+    template <typename It> flat_set(It first, It last, const Compare &c = Compare()) : idx_(c)
+    {
+        insert(first, last);
+    }
+    flat_set(std::initializer_list<Key> il, const Compare &c = Compare())
+        : flat_set(il.begin(), il.end(), c)
+    {
+    }
+
+    iterator begin() const { return idx_.keys.begin(); }
+    iterator end() const { return idx_.keys.end(); }
+    size_type size() const { return idx_.keys.size(); }
+    bool empty() const { return idx_.keys.empty(); }
+    void reserve(size_type n) { idx_.keys.reserve(n); }
+    void clear() { idx_.clear(); }
+    key_compare key_comp() const { return idx_.comp; }
+
+    iterator lower_bound(const Key &k) const { return begin() + idx_.lower_bound(k); }
+    iterator find(const Key &k) const { return begin() + idx_.find(k); }
+    bool contains(const Key &k) const { return idx_.find(k) != size(); }
+    size_type count(const Key &k) const { return contains(k) ? 1 : 0; }
+
+    std::pair<iterator, bool> insert(const Key &k)
+    {
+        auto i = idx_.lower_bound(k);
+        if (i < size() && !idx_.comp(k, idx_.keys[i]))
+            return {begin() + i, false};
+        idx_.keys.insert(idx_.keys.begin() + i, k);
+        idx_.rebuild();
+        return {begin() + i, true};
+    }
+
+    // Bulk insert: sort the new keys once and merge, rather than shifting per element. The
+    // merge is planned and built aside, so a throwing copy, comparator or allocation leaves
+    // the set as it was.
+    template <typename It> void insert(It first, It last)
+    {
+        std::vector<Key> incoming(first, last);
+        std::stable_sort(incoming.begin(), incoming.end(), idx_.comp);
+
+        auto n = size();
+        auto source = [&](size_t c) -> Key & { return c < n ? idx_.keys[c] : incoming[c - n]; };
+        auto plan = detail::flat_merge_plan(
+            idx_.keys, incoming.size(), [&](size_t j) -> const Key & { return incoming[j]; },
+            idx_.comp);
+        auto staged =
+            idx_.stage(plan.size(), [&](size_t i) -> const Key & { return source(plan[i]); });
+
+        std::vector<Key> keys;
+        keys.reserve(plan.size());
+        for (auto c : plan)
+            keys.push_back(std::move_if_noexcept(source(c)));
+        idx_.commit(keys, staged);
+    }
+
+    size_type erase(const Key &k)
+    {
+        auto i = idx_.find(k);
+        if (i == size())
+            return 0;
+        idx_.keys.erase(idx_.keys.begin() + i);
+        idx_.rebuild();
+        return 1;
+    }
+    iterator erase(iterator pos)
+    {
+        auto i = pos - begin();
+        idx_.keys.erase(idx_.keys.begin() + i);
+        idx_.rebuild();
+        return begin() + i;
+    }
+
+    friend bool operator==(const flat_set &a, const flat_set &b)
+    {
+        return a.idx_.keys == b.idx_.keys;
+    }
+    friend bool operator!=(const flat_set &a, const flat_set &b) { return !(a == b); }
+
+  private:
+    detail::flat_index<Key, Compare, Layout> idx_;
+};
+
+/*
+ * A map stored as two sorted parallel arrays, one of keys and one of values, so searches
+ * only walk the densely packed keys. See flat_set for the lookup and invalidation rules.
+ *
+ * Dereferencing an iterator gives a std::pair<const Key &, T &>, so structured bindings and
+ * it->first / it->second work as with std::map:
+ *
+ * ```
+ * sst::cpputils::flat_map<int, float> m{{3, 0.5f}, {1, 0.25f}};
+ * for (auto [k, v] : m)
+ *     v *= 2;
+ * ```
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          flat_layout Layout = flat_layout::sorted>
+class flat_map
+{
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using size_type = size_t;
+
+    template <bool isConst> class iterator_impl
+    {
+        using map_t = std::conditional_t<isConst, const flat_map, flat_map>;
+        using mapped_ref = std::conditional_t<isConst, const T &, T &>;
+
+      public:
+        /*
+         * operator* returns a pair of references by value, so this is a proxy iterator in
+         * the C++20 sense: random access by iterator_concept, but only an input iterator to
+         * C++17 algorithms, which need a real value_type & for anything stronger. It does
+         * support +, - and [] directly, and std::distance and std::next work.
+         */
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = std::pair<Key, T>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const Key &, mapped_ref>;
+
+        struct pointer
+        {
+            reference ref;
+            const reference *operator->() const { return &ref; }
+        };
+
+        iterator_impl() = default;
+        iterator_impl(map_t *m, size_t i) : map(m), idx(i) {}
+        template <bool wasConst, typename = std::enable_if_t<isConst && !wasConst>>
+        iterator_impl(const iterator_impl<wasConst> &o) : map(o.map), idx(o.idx)
+        {
+        }
+
+        reference operator*() const { return {map->idx_.keys[idx], map->values_[idx]}; }
+        pointer operator->() const { return {**this}; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        iterator_impl &operator++()
+        {
+            ++idx;
+            return *this;
+        }
+        iterator_impl operator++(int)
+        {
+            auto r = *this;
+            ++idx;
+            return r;
+        }
+        iterator_impl &operator--()
+        {
+            --idx;
+            return *this;
+        }
+        iterator_impl operator--(int)
+        {
+            auto r = *this;
+            --idx;
+            return r;
+        }
+        iterator_impl &operator+=(difference_type n)
+        {
+            idx += n;
+            return *this;
+        }
+        iterator_impl &operator-=(difference_type n)
+        {
+            idx -= n;
+            return *this;
+        }
+        iterator_impl operator+(difference_type n) const { return {map, idx + n}; }
+        iterator_impl operator-(difference_type n) const { return {map, idx - n}; }
+        difference_type operator-(const iterator_impl &o) const
+        {
+            return (difference_type)idx - (difference_type)o.idx;
+        }
+
+        bool operator==(const iterator_impl &o) const { return idx == o.idx; }
+        bool operator!=(const iterator_impl &o) const { return idx != o.idx; }
+        bool operator<(const iterator_impl &o) const { return idx < o.idx; }
+        bool operator>(const iterator_impl &o) const { return idx > o.idx; }
+        bool operator<=(const iterator_impl &o) const { return idx <= o.idx; }
+        bool operator>=(const iterator_impl &o) const { return idx >= o.idx; }
+
+      private:
+        map_t *map{nullptr};
+        size_t idx{0};
+        friend class flat_map;
+        template <bool> friend class iterator_impl;
+    };
+    using iterator = iterator_impl<false>;
+    using const_iterator = iterator_impl<true>;
+
+    flat_map() = default;
+    explicit flat_map(const Compare &c) : idx_(c) {}
+    template <typename It> flat_map(It first, It last, const Compare &c = Compare()) : idx_(c)
+    {
+        insert(first, last);
+    }
+    flat_map(std::initializer_list<value_type> il, const Compare &c = Compare())
+        : flat_map(il.begin(), il.end(), c)
+    {
+    }
+
+    iterator begin() { return {this, 0}; }
+    iterator end() { return {this, size()}; }
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, size()}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_type size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    void reserve(size_type n)
+    {
+        idx_.keys.reserve(n);
+        values_.reserve(n);
+    }
+    void clear()
+    {
+        idx_.clear();
+        values_.clear();
+    }
+    key_compare key_comp() const { return idx_.comp; }
+
+    // The sorted keys and their values, as contiguous arrays.
+    const std::vector<Key> &keys() const { return idx_.keys; }
+    const std::vector<T> &values() const { return values_; }
+
+    iterator lower_bound(const Key &k) { return {this, idx_.lower_bound(k)}; }
+    const_iterator lower_bound(const Key &k) const { return {this, idx_.lower_bound(k)}; }
+    iterator find(const Key &k) { return {this, idx_.find(k)}; }
+    const_iterator find(const Key &k) const { return {this, idx_.find(k)}; }
+    bool contains(const Key &k) const { return idx_.find(k) != size(); }
+    size_type count(const Key &k) const { return contains(k) ? 1 : 0; }
+
+    T &at(const Key &k)
+    {
+        auto i = idx_.find(k);
+        if (i == size())
+            throw std::out_of_range("flat_map::at");
+        return values_[i];
+    }
+    const T &at(const Key &k) const
+    {
+        auto i = idx_.find(k);
+        if (i == size())
+            throw std::out_of_range("flat_map::at");
+        return values_[i];
+    }
+    T &operator[](const Key &k) { return try_emplace(k).first->second; }
+
+    template <typename... Args> std::pair<iterator, bool> try_emplace(const Key &k, Args &&...args)
+    {
+        auto i = idx_.lower_bound(k);
+        if (i < size() && !idx_.comp(k, idx_.keys[i]))
+            return {{this, i}, false};
+        idx_.keys.insert(idx_.keys.begin() + i, k);
+        values_.emplace(values_.begin() + i, std::forward<Args>(args)...);
+        idx_.rebuild();
+        return {{this, i}, true};
+    }
+    std::pair<iterator, bool> insert(const value_type &v) { return try_emplace(v.first, v.second); }
+    template <typename M> std::pair<iterator, bool> insert_or_assign(const Key &k, M &&m)
+    {
+        auto res = try_emplace(k, std::forward<M>(m));
+        if (!res.second)
+            values_[res.first.idx] = std::forward<M>(m);
+        return res;
+    }
+
+    // Bulk insert: sort the new pairs once and merge. On duplicate keys the first wins, as
+    // with repeated std::map::insert. The merge is planned with the comparator and built
+    // aside before the map is touched, so a throwing copy, comparator or allocation leaves it
+    // as it was.
+    template <typename It> void insert(It first, It last)
+    {
+        std::vector<value_type> incoming(first, last);
+        auto lt = [this](const value_type &a, const value_type &b) {
+            return idx_.comp(a.first, b.first);
+        };
+        std::stable_sort(incoming.begin(), incoming.end(), lt);
+
+        auto n = size();
+        auto keyAt = [&](size_t c) -> Key & {
+            return c < n ? idx_.keys[c] : incoming[c - n].first;
+        };
+        auto plan = detail::flat_merge_plan(
+            idx_.keys, incoming.size(),
+            [&](size_t j) -> const Key & { return incoming[j].first; }, idx_.comp);
+        auto staged =
+            idx_.stage(plan.size(), [&](size_t i) -> const Key & { return keyAt(plan[i]); });
+
+        std::vector<Key> keys;
+        std::vector<T> values;
+        keys.reserve(plan.size());
+        values.reserve(plan.size());
+        auto takeKeys = [&] {
+            for (auto c : plan)
+                keys.push_back(std::move_if_noexcept(keyAt(c)));
+        };
+        auto valueAt = [&](size_t c) -> T & { return c < n ? values_[c] : incoming[c - n].second; };
+        auto takeValues = [&] {
+            for (auto c : plan)
+                values.push_back(std::move_if_noexcept(valueAt(c)));
+        };
+        // Whichever of the two is copied, and so may throw, goes before the one which is moved
+        if constexpr (std::is_nothrow_move_constructible_v<Key>)
+        {
+            takeValues();
+            takeKeys();
+        }
+        else
+        {
+            takeKeys();
+            takeValues();
+        }
+        idx_.commit(keys, staged);
+        values_.swap(values);
+    }
+
+    size_type erase(const Key &k)
+    {
+        auto i = idx_.find(k);
+        if (i == size())
+            return 0;
+        eraseAt(i);
+        return 1;
+    }
+    iterator erase(const_iterator pos)
+    {
+        eraseAt(pos.idx);
+        return {this, pos.idx};
+    }
+
+    friend bool operator==(const flat_map &a, const flat_map &b)
+    {
+        return a.idx_.keys == b.idx_.keys && a.values_ == b.values_;
+    }
+    friend bool operator!=(const flat_map &a, const flat_map &b) { return !(a == b); }
+
+  private:
+    void eraseAt(size_t i)
+    {
+        idx_.keys.erase(idx_.keys.begin() + i);
+        values_.erase(values_.begin() + i);
+        idx_.rebuild();
+    }
+
+    detail::flat_index<Key, Compare, Layout> idx_;
+    std::vector<T> values_;
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_FLAT_MAP_H
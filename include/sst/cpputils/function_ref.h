@@ -0,0 +1,105 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_FUNCTION_REF_H
+#define INCLUDE_SST_CPPUTILS_FUNCTION_REF_H
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace sst
+{
+namespace cpputils
+{
+template <typename Sig> class function_ref;
+
+/**
+ * A non-owning reference to a callable: a pointer to it and a pointer to a function which
+ * calls it, and nothing else. Constructing one never copies or allocates, so a function which
+ * takes a visitor or predicate as a function_ref can live in a translation unit, instead of
+ * being a template instantiated again at every call site, at the cost of one indirect call.
+ *
+ * Like std::string_view it does not extend the lifetime of what it refers to, so use it for
+ * parameters, not for storing callbacks; for those see inplace_function. Function pointers are
+ * held by value, so passing `&someFunction` is fine.
+ *
+ * ```
+ * void forEachVoice(sst::cpputils::function_ref<void(Voice &)> fn);
+ *
+ * forEachVoice([&](auto &v) { v.release(); });
+ * ```
+ */
+template <typename R, typename... Args> class function_ref<R(Args...)>
+{
+    union target_t
+    {
+        const void *obj;
+        void (*fn)();
+    };
+
+    template <typename F> static R callObject(target_t t, Args... args)
+    {
+        auto &f = *static_cast<F *>(const_cast<void *>(t.obj));
+        if constexpr (std::is_void_v<R>)
+            std::invoke(f, std::forward<Args>(args)...);
+        else
+            return std::invoke(f, std::forward<Args>(args)...);
+    }
+    template <typename Fn> static R callFunction(target_t t, Args... args)
+    {
+        auto fn = reinterpret_cast<Fn>(t.fn);
+        if constexpr (std::is_void_v<R>)
+            fn(std::forward<Args>(args)...);
+        else
+            return fn(std::forward<Args>(args)...);
+    }
+
+  public:
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, function_ref> &&
+                                          std::is_invocable_r_v<R, F &, Args...>>>
+    function_ref(F &&f) noexcept
+    {
+        if constexpr (std::is_pointer_v<D> && std::is_function_v<std::remove_pointer_t<D>>)
+        {
+            // functions, and pointers to them, are referenced by value
+            D fn = f;
+            target.fn = reinterpret_cast<void (*)()>(fn);
+            callback = &callFunction<D>;
+        }
+        else
+        {
+            target.obj = static_cast<const void *>(std::addressof(f));
+            callback = &callObject<std::remove_reference_t<F>>;
+        }
+    }
+
+    function_ref(const function_ref &) noexcept = default;
+    function_ref &operator=(const function_ref &) noexcept = default;
+
+    R operator()(Args... args) const { return callback(target, std::forward<Args>(args)...); }
+
+  private:
+    target_t target;
+    R (*callback)(target_t, Args...);
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_FUNCTION_REF_H
@@ -0,0 +1,232 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_INPLACE_FUNCTION_H
+#define INCLUDE_SST_CPPUTILS_INPLACE_FUNCTION_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sst
+{
+namespace cpputils
+{
+#ifndef DOXYGEN
+namespace detail
+{
+template <typename Sig, size_t Capacity, size_t Align, bool Copyable> class basic_inplace_function;
+
+template <typename T> struct is_basic_inplace_function : std::false_type
+{
+};
+template <typename Sig, size_t C, size_t A, bool Cp>
+struct is_basic_inplace_function<basic_inplace_function<Sig, C, A, Cp>> : std::true_type
+{
+};
+
+template <typename R, typename... Args, size_t Capacity, size_t Align, bool Copyable>
+class basic_inplace_function<R(Args...), Capacity, Align, Copyable>
+{
+    // Stands in for the copy operations' parameter when they should not exist, which leaves
+    // the implicit ones deleted by the user declared moves.
+    struct not_copyable
+    {
+    };
+    using copy_source_t =
+        std::conditional_t<Copyable, const basic_inplace_function &, const not_copyable &>;
+
+    struct vtable_t
+    {
+        R (*invoke)(void *, Args &&...);
+        void (*copy)(void *dst, const void *src);
+        void (*relocate)(void *dst, void *src); // move construct, then destroy src
+        void (*destroy)(void *);
+    };
+
+    static R invokeEmpty(void *, Args &&...) { throw std::bad_function_call(); }
+    static void copyEmpty(void *, const void *) {}
+    static void relocateEmpty(void *, void *) {}
+    static void destroyEmpty(void *) {}
+    static constexpr vtable_t emptyVTable{&invokeEmpty, &copyEmpty, &relocateEmpty,
+                                          &destroyEmpty};
+
+    template <typename F> static R invokeImpl(void *p, Args &&...args)
+    {
+        if constexpr (std::is_void_v<R>)
+            std::invoke(*static_cast<F *>(p), std::forward<Args>(args)...);
+        else
+            return std::invoke(*static_cast<F *>(p), std::forward<Args>(args)...);
+    }
+    template <typename F> static void copyImpl(void *dst, const void *src)
+    {
+        if constexpr (Copyable)
+            ::new (dst) F(*static_cast<const F *>(src));
+    }
+    template <typename F> static void relocateImpl(void *dst, void *src)
+    {
+        ::new (dst) F(std::move(*static_cast<F *>(src)));
+        static_cast<F *>(src)->~F();
+    }
+    template <typename F> static void destroyImpl(void *p) { static_cast<F *>(p)->~F(); }
+    template <typename F>
+    static constexpr vtable_t vtableFor{&invokeImpl<F>, &copyImpl<F>, &relocateImpl<F>,
+                                        &destroyImpl<F>};
+
+  public:
+    using result_type = R;
+
+    basic_inplace_function() noexcept = default;
+    basic_inplace_function(std::nullptr_t) noexcept {}
+
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!is_basic_inplace_function<D>::value &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    basic_inplace_function(F &&f)
+    {
+        static_assert(sizeof(D) <= Capacity,
+                      "callable does not fit in this inplace_function; raise its Capacity");
+        static_assert(Align % alignof(D) == 0,
+                      "callable is over-aligned for this inplace_function; raise its Align");
+        static_assert(!Copyable || std::is_copy_constructible_v<D>,
+                      "inplace_function needs a copyable callable; use inplace_unique_function");
+        static_assert(std::is_nothrow_move_constructible_v<D>,
+                      "inplace_function moves are noexcept, so the callable's move must be "
+                      "too; use unique_function, which boxes it");
+
+        if constexpr (std::is_pointer_v<D> || std::is_member_pointer_v<D>)
+        {
+            if (f == nullptr)
+                return;
+        }
+        ::new (static_cast<void *>(storage)) D(std::forward<F>(f));
+        vtable = &vtableFor<D>;
+    }
+
+    basic_inplace_function(copy_source_t o) : vtable(o.vtable)
+    {
+        vtable->copy(storage, o.storage);
+    }
+    basic_inplace_function(basic_inplace_function &&o) noexcept : vtable(o.vtable)
+    {
+        vtable->relocate(storage, o.storage);
+        o.vtable = &emptyVTable;
+    }
+
+    basic_inplace_function &operator=(copy_source_t o)
+    {
+        if (&o != this)
+        {
+            vtable->destroy(storage);
+            vtable = &emptyVTable;
+            o.vtable->copy(storage, o.storage);
+            vtable = o.vtable;
+        }
+        return *this;
+    }
+    basic_inplace_function &operator=(basic_inplace_function &&o) noexcept
+    {
+        if (&o != this)
+        {
+            vtable->destroy(storage);
+            vtable = o.vtable;
+            vtable->relocate(storage, o.storage);
+            o.vtable = &emptyVTable;
+        }
+        return *this;
+    }
+    basic_inplace_function &operator=(std::nullptr_t) noexcept
+    {
+        vtable->destroy(storage);
+        vtable = &emptyVTable;
+        return *this;
+    }
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!is_basic_inplace_function<D>::value &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    basic_inplace_function &operator=(F &&f)
+    {
+        return *this = basic_inplace_function(std::forward<F>(f));
+    }
+
+    ~basic_inplace_function() { vtable->destroy(storage); }
+
+    // Calling an empty function throws std::bad_function_call, as std::function does.
+    R operator()(Args... args) const
+    {
+        return vtable->invoke(storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return vtable != &emptyVTable; }
+    friend bool operator==(const basic_inplace_function &f, std::nullptr_t) noexcept
+    {
+        return !f;
+    }
+    friend bool operator!=(const basic_inplace_function &f, std::nullptr_t) noexcept
+    {
+        return static_cast<bool>(f);
+    }
+
+    void swap(basic_inplace_function &o) noexcept
+    {
+        basic_inplace_function tmp(std::move(o));
+        o = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+    static constexpr size_t alignment() { return Align; }
+
+  private:
+    const vtable_t *vtable{&emptyVTable};
+    // mutable since, like std::function, a const wrapper still calls a mutable callable
+    alignas(Align) mutable unsigned char storage[Capacity];
+};
+} // namespace detail
+#endif // DOXYGEN
+
+/**
+ * A std::function replacement which never allocates: the callable lives in Capacity bytes of
+ * inline storage, and a callable which does not fit is a compile error rather than a silent
+ * trip to the heap. Use it for callbacks that are installed, copied or called on the audio
+ * thread. A bind_front of a member function and an object pointer needs three pointers.
+ * Moves are noexcept, so a callable whose move constructor may throw is a compile error too;
+ * unique_function takes those by boxing them.
+ *
+ * ```
+ * sst::cpputils::inplace_function<void(float), 32> onChange =
+ *     sst::cpputils::bind_front(&Voice::setCutoff, &voice);
+ * onChange(0.5f);
+ * ```
+ */
+template <typename Sig, size_t Capacity = 4 * sizeof(void *),
+          size_t Align = alignof(std::max_align_t)>
+using inplace_function = detail::basic_inplace_function<Sig, Capacity, Align, true>;
+
+/**
+ * A move-only inplace_function, which can therefore hold move-only callables, such as a
+ * lambda owning a std::unique_ptr.
+ */
+template <typename Sig, size_t Capacity = 4 * sizeof(void *),
+          size_t Align = alignof(std::max_align_t)>
+using inplace_unique_function = detail::basic_inplace_function<Sig, Capacity, Align, false>;
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_INPLACE_FUNCTION_H
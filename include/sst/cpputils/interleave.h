@@ -0,0 +1,348 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_INTERLEAVE_H
+#define INCLUDE_SST_CPPUTILS_INTERLEAVE_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "detail/platform.h"
+#include "iterators.h"
+
+namespace sst
+{
+namespace cpputils
+{
+
+/*
+ * A zero-copy view over an interleaved multichannel buffer, laid out frame by frame
+ * (L R L R ... for stereo). channel(c) is a strided_span over one channel, frame(f) is a
+ * pointer to the `channels()` samples of one frame.
+ *
+ * ```
+ * float buf[2 * 64];
+ * auto v = sst::cpputils::interleaved_view(buf, 2, 64);
+ * for (auto [l, r] : sst::cpputils::zip(v.channel(0), v.channel(1)))
+ * {
+ *     std::swap(l, r);
+ * }
+ * ```
+ */
+template <typename T> class interleaved_view
+{
+  public:
+    using value_type = std::remove_cv_t<T>;
+
+    constexpr interleaved_view(T *data, size_t channels, size_t frames)
+        : data_(data), channels_(channels), frames_(frames)
+    {
+    }
+
+    constexpr strided_span<T> channel(size_t c) const { return {data_ + c, channels_, frames_}; }
+    constexpr T *frame(size_t f) const { return data_ + f * channels_; }
+    constexpr T &operator()(size_t c, size_t f) const { return data_[f * channels_ + c]; }
+
+    constexpr T *data() const { return data_; }
+    constexpr size_t channels() const { return channels_; }
+    constexpr size_t frames() const { return frames_; }
+    constexpr size_t size() const { return channels_ * frames_; }
+
+  private:
+    T *data_;
+    size_t channels_;
+    size_t frames_;
+};
+
+#ifndef DOXYGEN
+namespace detail
+{
+// With the channel count a compile time constant the inner loop fully unrolls and the
+// compiler is free to vectorize the rest; this is also the tail handler for the SIMD paths.
+template <size_t C, typename T>
+void interleave_fixed(const T *const *planar, T *out, size_t from, size_t frames)
+{
+    for (size_t f = from; f < frames; ++f)
+        for (size_t c = 0; c < C; ++c)
+            out[f * C + c] = planar[c][f];
+}
+
+template <size_t C, typename T>
+void deinterleave_fixed(const T *in, T *const *planar, size_t from, size_t frames)
+{
+    for (size_t f = from; f < frames; ++f)
+        for (size_t c = 0; c < C; ++c)
+            planar[c][f] = in[f * C + c];
+}
+
+#if SST_CPPUTILS_SIMD_SSE2
+inline size_t interleave_simd2(const float *const *p, float *out, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        auto l = _mm_loadu_ps(p[0] + f), r = _mm_loadu_ps(p[1] + f);
+        _mm_storeu_ps(out + 2 * f, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(out + 2 * f + 4, _mm_unpackhi_ps(l, r));
+    }
+    return f;
+}
+
+inline size_t deinterleave_simd2(const float *in, float *const *p, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        auto a = _mm_loadu_ps(in + 2 * f), b = _mm_loadu_ps(in + 2 * f + 4);
+        _mm_storeu_ps(p[0] + f, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(p[1] + f, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    return f;
+}
+
+// Four frames of four channels is a 4x4 transpose either way round.
+inline size_t interleave_simd4(const float *const *p, float *out, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        auto a = _mm_loadu_ps(p[0] + f), b = _mm_loadu_ps(p[1] + f);
+        auto c = _mm_loadu_ps(p[2] + f), d = _mm_loadu_ps(p[3] + f);
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+        _mm_storeu_ps(out + 4 * f, a);
+        _mm_storeu_ps(out + 4 * f + 4, b);
+        _mm_storeu_ps(out + 4 * f + 8, c);
+        _mm_storeu_ps(out + 4 * f + 12, d);
+    }
+    return f;
+}
+
+inline size_t deinterleave_simd4(const float *in, float *const *p, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        auto a = _mm_loadu_ps(in + 4 * f), b = _mm_loadu_ps(in + 4 * f + 4);
+        auto c = _mm_loadu_ps(in + 4 * f + 8), d = _mm_loadu_ps(in + 4 * f + 12);
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+        _mm_storeu_ps(p[0] + f, a);
+        _mm_storeu_ps(p[1] + f, b);
+        _mm_storeu_ps(p[2] + f, c);
+        _mm_storeu_ps(p[3] + f, d);
+    }
+    return f;
+}
+
+// Eight channels are two 4x4 transposes, one for each half of the frame.
+inline size_t interleave_simd8(const float *const *p, float *out, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        for (size_t h = 0; h < 2; ++h)
+        {
+            auto a = _mm_loadu_ps(p[4 * h] + f), b = _mm_loadu_ps(p[4 * h + 1] + f);
+            auto c = _mm_loadu_ps(p[4 * h + 2] + f), d = _mm_loadu_ps(p[4 * h + 3] + f);
+            _MM_TRANSPOSE4_PS(a, b, c, d);
+            auto o = out + 8 * f + 4 * h;
+            _mm_storeu_ps(o, a);
+            _mm_storeu_ps(o + 8, b);
+            _mm_storeu_ps(o + 16, c);
+            _mm_storeu_ps(o + 24, d);
+        }
+    }
+    return f;
+}
+
+inline size_t deinterleave_simd8(const float *in, float *const *p, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        for (size_t h = 0; h < 2; ++h)
+        {
+            auto i = in + 8 * f + 4 * h;
+            auto a = _mm_loadu_ps(i), b = _mm_loadu_ps(i + 8);
+            auto c = _mm_loadu_ps(i + 16), d = _mm_loadu_ps(i + 24);
+            _MM_TRANSPOSE4_PS(a, b, c, d);
+            _mm_storeu_ps(p[4 * h] + f, a);
+            _mm_storeu_ps(p[4 * h + 1] + f, b);
+            _mm_storeu_ps(p[4 * h + 2] + f, c);
+            _mm_storeu_ps(p[4 * h + 3] + f, d);
+        }
+    }
+    return f;
+}
+#elif SST_CPPUTILS_SIMD_NEON
+inline size_t interleave_simd2(const float *const *p, float *out, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+        vst2q_f32(out + 2 * f, (float32x4x2_t{{vld1q_f32(p[0] + f), vld1q_f32(p[1] + f)}}));
+    return f;
+}
+
+inline size_t deinterleave_simd2(const float *in, float *const *p, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        auto v = vld2q_f32(in + 2 * f);
+        vst1q_f32(p[0] + f, v.val[0]);
+        vst1q_f32(p[1] + f, v.val[1]);
+    }
+    return f;
+}
+
+inline size_t interleave_simd4(const float *const *p, float *out, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+        vst4q_f32(out + 4 * f, (float32x4x4_t{{vld1q_f32(p[0] + f), vld1q_f32(p[1] + f),
+                                               vld1q_f32(p[2] + f), vld1q_f32(p[3] + f)}}));
+    return f;
+}
+
+inline size_t deinterleave_simd4(const float *in, float *const *p, size_t frames)
+{
+    size_t f = 0;
+    for (; f + 4 <= frames; f += 4)
+    {
+        auto v = vld4q_f32(in + 4 * f);
+        for (size_t c = 0; c < 4; ++c)
+            vst1q_f32(p[c] + f, v.val[c]);
+    }
+    return f;
+}
+
+inline size_t interleave_simd8(const float *const *, float *, size_t) { return 0; }
+inline size_t deinterleave_simd8(const float *, float *const *, size_t) { return 0; }
+#endif
+
+template <size_t C, typename T>
+void interleave_dispatch(const T *const *planar, T *out, size_t frames)
+{
+    size_t done{0};
+#if SST_CPPUTILS_SIMD_SSE2 || SST_CPPUTILS_SIMD_NEON
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if constexpr (C == 2)
+            done = interleave_simd2(planar, out, frames);
+        else if constexpr (C == 4)
+            done = interleave_simd4(planar, out, frames);
+        else if constexpr (C == 8)
+            done = interleave_simd8(planar, out, frames);
+    }
+#endif
+    interleave_fixed<C>(planar, out, done, frames);
+}
+
+template <size_t C, typename T>
+void deinterleave_dispatch(const T *in, T *const *planar, size_t frames)
+{
+    size_t done{0};
+#if SST_CPPUTILS_SIMD_SSE2 || SST_CPPUTILS_SIMD_NEON
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if constexpr (C == 2)
+            done = deinterleave_simd2(in, planar, frames);
+        else if constexpr (C == 4)
+            done = deinterleave_simd4(in, planar, frames);
+        else if constexpr (C == 8)
+            done = deinterleave_simd8(in, planar, frames);
+    }
+#endif
+    deinterleave_fixed<C>(in, planar, done, frames);
+}
+} // namespace detail
+#endif // DOXYGEN
+
+/**
+ * Interleave `channels` planar buffers of `frames` samples each into `out`, which must hold
+ * channels * frames samples. 1, 2, 4 and 8 channels have dedicated kernels (SSE2 or NEON
+ * shuffles for float); any other count takes a generic loop. The buffers must not overlap.
+ */
+template <typename T>
+void interleave(const T *const *planar, T *out, size_t channels, size_t frames)
+{
+    switch (channels)
+    {
+    case 1:
+        detail::interleave_dispatch<1>(planar, out, frames);
+        break;
+    case 2:
+        detail::interleave_dispatch<2>(planar, out, frames);
+        break;
+    case 4:
+        detail::interleave_dispatch<4>(planar, out, frames);
+        break;
+    case 8:
+        detail::interleave_dispatch<8>(planar, out, frames);
+        break;
+    default:
+        for (size_t f = 0; f < frames; ++f)
+            for (size_t c = 0; c < channels; ++c)
+                out[f * channels + c] = planar[c][f];
+        break;
+    }
+}
+
+/**
+ * The inverse of interleave: split `in`, holding channels * frames samples, into `channels`
+ * planar buffers of `frames` samples each.
+ */
+template <typename T>
+void deinterleave(const T *in, T *const *planar, size_t channels, size_t frames)
+{
+    switch (channels)
+    {
+    case 1:
+        detail::deinterleave_dispatch<1>(in, planar, frames);
+        break;
+    case 2:
+        detail::deinterleave_dispatch<2>(in, planar, frames);
+        break;
+    case 4:
+        detail::deinterleave_dispatch<4>(in, planar, frames);
+        break;
+    case 8:
+        detail::deinterleave_dispatch<8>(in, planar, frames);
+        break;
+    default:
+        for (size_t f = 0; f < frames; ++f)
+            for (size_t c = 0; c < channels; ++c)
+                planar[c][f] = in[f * channels + c];
+        break;
+    }
+}
+
+/** Interleave planar buffers into the storage behind an interleaved_view. */
+template <typename T> void interleave(const T *const *planar, const interleaved_view<T> &out)
+{
+    interleave(planar, out.data(), out.channels(), out.frames());
+}
+
+/** Split the contents of an interleaved_view into planar buffers. */
+template <typename T, typename U>
+void deinterleave(const interleaved_view<U> &in, T *const *planar)
+{
+    static_assert(std::is_same_v<std::remove_cv_t<U>, T>);
+    deinterleave<T>(in.data(), planar, in.channels(), in.frames());
+}
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_INTERLEAVE_H
@@ -0,0 +1,216 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_LOOKUP_TABLE_H
+#define INCLUDE_SST_CPPUTILS_LOOKUP_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "constructors.h"
+#include "detail/platform.h"
+
+namespace sst
+{
+namespace cpputils
+{
+/**
+ * N samples of a function over [lo, hi], evenly spaced and including both ends, with
+ * interpolated lookups between them. Inputs outside [lo, hi] are clamped to the end samples,
+ * and NaN reads the first one, so a lookup never reads out of bounds.
+ *
+ * Build one with make_table. The scalar lookups are constexpr; the batch lookups use AVX2
+ * gathers for float tables when the target has AVX2, and a scalar loop otherwise, with the
+ * same arithmetic so they give the same results.
+ */
+template <typename T, size_t N> class lookup_table
+{
+    static_assert(std::is_floating_point_v<T>, "lookup_table interpolates floating point values");
+    static_assert(N >= 2, "lookup_table needs at least two samples to interpolate");
+
+  public:
+    constexpr lookup_table(const std::array<T, N> &samples, T lo, T hi)
+        : samples_(samples), lo_(lo), hi_(hi), scale_(static_cast<T>(N - 1) / (hi - lo))
+    {
+    }
+
+    static constexpr size_t size() { return N; }
+    constexpr T lo() const { return lo_; }
+    constexpr T hi() const { return hi_; }
+    constexpr T operator[](size_t i) const { return samples_[i]; }
+    constexpr const std::array<T, N> &samples() const { return samples_; }
+
+    // Piecewise linear interpolation between the two nearest samples
+    constexpr T lookup_linear(T x) const
+    {
+        size_t i{0};
+        T f{0};
+        locate(x, i, f);
+        auto a = samples_[i], b = samples_[i + 1];
+        return a + f * (b - a);
+    }
+
+    // Catmull-Rom interpolation over the four nearest samples, extrapolating a sample linearly
+    // past each end. Passes through every sample, with a continuous first derivative.
+    constexpr T lookup_cubic(T x) const
+    {
+        size_t i{0};
+        T f{0};
+        locate(x, i, f);
+        auto p1 = samples_[i], p2 = samples_[i + 1];
+        auto p0 = i > 0 ? samples_[i - 1] : T(2) * p1 - p2;
+        auto p3 = i + 2 < N ? samples_[i + 2] : T(2) * p2 - p1;
+        return catmullRom(p0, p1, p2, p3, f);
+    }
+
+    // out[k] = lookup_linear(in[k]) for k in [0, n)
+    void lookup_linear(const T *in, T *out, size_t n) const
+    {
+        size_t k{0};
+#if SST_CPPUTILS_SIMD_AVX2
+        if constexpr (std::is_same_v<T, float> && N < INT32_MAX)
+        {
+            for (; k + 8 <= n; k += 8)
+            {
+                __m256 f;
+                auto i = locate8(_mm256_loadu_ps(in + k), f);
+                auto a = _mm256_i32gather_ps(samples_.data(), i, 4);
+                auto b = _mm256_i32gather_ps(samples_.data() + 1, i, 4);
+                _mm256_storeu_ps(out + k, _mm256_add_ps(a, _mm256_mul_ps(f, _mm256_sub_ps(b, a))));
+            }
+        }
+#endif
+        for (; k < n; ++k)
+            out[k] = lookup_linear(in[k]);
+    }
+
+    // out[k] = lookup_cubic(in[k]) for k in [0, n)
+    void lookup_cubic(const T *in, T *out, size_t n) const
+    {
+        size_t k{0};
+#if SST_CPPUTILS_SIMD_AVX2
+        if constexpr (std::is_same_v<T, float> && N < INT32_MAX)
+        {
+            const auto zero = _mm256_setzero_si256();
+            const auto last = _mm256_set1_epi32((int)(N - 1));
+            const auto one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+            const auto half = _mm256_set1_ps(0.5f), onePointFive = _mm256_set1_ps(1.5f);
+            const auto twoF = _mm256_set1_ps(2.f), twoPointFive = _mm256_set1_ps(2.5f);
+            const auto *s = samples_.data();
+            for (; k + 8 <= n; k += 8)
+            {
+                __m256 f;
+                auto i = locate8(_mm256_loadu_ps(in + k), f);
+                auto im1 = _mm256_sub_epi32(i, one);
+                auto ip2 = _mm256_add_epi32(i, two);
+                auto p1 = _mm256_i32gather_ps(s, i, 4);
+                auto p2 = _mm256_i32gather_ps(s + 1, i, 4);
+                auto p0 = _mm256_i32gather_ps(s, _mm256_max_epi32(im1, zero), 4);
+                auto p3 = _mm256_i32gather_ps(s, _mm256_min_epi32(ip2, last), 4);
+
+                // extrapolate past the ends, as lookup_cubic does
+                auto before = _mm256_castsi256_ps(_mm256_cmpgt_epi32(zero, im1));
+                auto after = _mm256_castsi256_ps(_mm256_cmpgt_epi32(ip2, last));
+                p0 = _mm256_blendv_ps(p0, _mm256_sub_ps(_mm256_mul_ps(twoF, p1), p2), before);
+                p3 = _mm256_blendv_ps(p3, _mm256_sub_ps(_mm256_mul_ps(twoF, p2), p1), after);
+
+                auto c1 = _mm256_mul_ps(half, _mm256_sub_ps(p2, p0));
+                auto c2 = _mm256_sub_ps(
+                    _mm256_add_ps(_mm256_sub_ps(p0, _mm256_mul_ps(twoPointFive, p1)),
+                                  _mm256_mul_ps(twoF, p2)),
+                    _mm256_mul_ps(half, p3));
+                auto c3 = _mm256_add_ps(_mm256_mul_ps(half, _mm256_sub_ps(p3, p0)),
+                                        _mm256_mul_ps(onePointFive, _mm256_sub_ps(p1, p2)));
+                auto r = _mm256_add_ps(_mm256_mul_ps(c3, f), c2);
+                r = _mm256_add_ps(_mm256_mul_ps(r, f), c1);
+                r = _mm256_add_ps(_mm256_mul_ps(r, f), p1);
+                _mm256_storeu_ps(out + k, r);
+            }
+        }
+#endif
+        for (; k < n; ++k)
+            out[k] = lookup_cubic(in[k]);
+    }
+
+  private:
+    // The segment [i, i + 1] holding x, and the fraction of the way along it. Written so
+    // the comparisons send NaN to 0, as the SIMD max and min do.
+    constexpr void locate(T x, size_t &i, T &f) const
+    {
+        T pos = (x - lo_) * scale_;
+        pos = pos > T(0) ? pos : T(0);
+        pos = pos < T(N - 1) ? pos : T(N - 1);
+        i = static_cast<size_t>(pos);
+        i = i < N - 2 ? i : N - 2;
+        f = pos - static_cast<T>(i);
+    }
+
+    static constexpr T catmullRom(T p0, T p1, T p2, T p3, T f)
+    {
+        T c1 = T(0.5) * (p2 - p0);
+        T c2 = p0 - T(2.5) * p1 + T(2) * p2 - T(0.5) * p3;
+        T c3 = T(0.5) * (p3 - p0) + T(1.5) * (p1 - p2);
+        return ((c3 * f + c2) * f + c1) * f + p1;
+    }
+
+#if SST_CPPUTILS_SIMD_AVX2
+    __m256i locate8(__m256 x, __m256 &f) const
+    {
+        auto pos = _mm256_mul_ps(_mm256_sub_ps(x, _mm256_set1_ps((float)lo_)),
+                                 _mm256_set1_ps((float)scale_));
+        pos = _mm256_min_ps(_mm256_max_ps(pos, _mm256_setzero_ps()),
+                            _mm256_set1_ps((float)(N - 1)));
+        auto i = _mm256_min_epi32(_mm256_cvttps_epi32(pos), _mm256_set1_epi32((int)(N - 2)));
+        f = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(i));
+        return i;
+    }
+#endif
+
+    std::array<T, N> samples_;
+    T lo_, hi_, scale_;
+};
+
+/**
+ * Sample fn at N evenly spaced points over [lo, hi], both ends included, into a lookup_table.
+ * Built with make_array_lambda, so when fn is constexpr the table can be too, with no startup
+ * cost:
+ *
+ * ```
+ * constexpr auto softClip = sst::cpputils::make_table<float, 1024>(
+ *     [](float x) { return x - x * x * x / 3; }, -1.f, 1.f);
+ * auto y = softClip.lookup_cubic(x);
+ *
+ * // libm is not constexpr, so this one is filled when first used
+ * static const auto sine = sst::cpputils::make_table<float, 4096>(
+ *     [](float x) { return std::sin(x); }, 0.f, 2 * M_PI);
+ * ```
+ */
+template <typename T, size_t N, typename Fn>
+constexpr lookup_table<T, N> make_table(Fn &&fn, T lo, T hi)
+{
+    return lookup_table<T, N>(make_array_lambda<T, N>([&](auto i) {
+                                  auto x = lo + (hi - lo) * ((double)i / (double)(N - 1));
+                                  return static_cast<T>(fn(static_cast<T>(x)));
+                              }),
+                              lo, hi);
+}
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_LOOKUP_TABLE_H
@@ -0,0 +1,185 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_MDARRAY_H
+#define INCLUDE_SST_CPPUTILS_MDARRAY_H
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "constructors.h"
+#include "iterators.h"
+
+namespace sst
+{
+namespace cpputils
+{
+/**
+ * A fixed size multi-dimensional array, stored as one contiguous row-major std::array: the
+ * last index varies fastest, so `grid(v, b)` and `grid(v, b + 1)` are neighbours. Compared
+ * with nested std::arrays the layout is the same, but a single buffer can be handed to flat
+ * loops and kernels, and any axis can be walked as a view.
+ *
+ * row(...) is the contiguous run along the last axis (row_data gives its pointer, for SIMD
+ * kernels), column(c) of a 2D array and line<Axis>(...) in general are strided_spans. All of
+ * these, and the mdarray itself, iterate, so they work with enumerate and zip.
+ *
+ * ```
+ * auto grid = sst::cpputils::make_array_nd<Filter, 8, 16>(
+ *     [](size_t voice, size_t band) { return Filter(voice, band); });
+ * for (auto &f : grid.row(voice)) f.reset();
+ * for (auto [band, f] : sst::cpputils::enumerate(grid.row(0))) ...
+ * ```
+ */
+template <typename T, size_t... Dims> class mdarray
+{
+    static_assert(sizeof...(Dims) >= 1, "mdarray needs at least one dimension");
+
+  public:
+    static constexpr size_t rank = sizeof...(Dims);
+    using value_type = T;
+    using index_type = std::array<size_t, rank>;
+    using storage_type = std::array<T, (Dims * ...)>;
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+
+    constexpr mdarray() = default;
+    constexpr explicit mdarray(storage_type d) : data_(std::move(d)) {}
+
+    static constexpr size_t size() { return (Dims * ...); }
+    static constexpr size_t extent(size_t axis) { return index_type{Dims...}[axis]; }
+    // The distance in elements between neighbours along an axis
+    static constexpr size_t stride(size_t axis)
+    {
+        size_t s{1};
+        for (auto a = axis + 1; a < rank; ++a)
+            s *= extent(a);
+        return s;
+    }
+
+    static constexpr size_t flat_index(const index_type &idx)
+    {
+        size_t res{0};
+        for (size_t a = 0; a < rank; ++a)
+            res = res * extent(a) + idx[a];
+        return res;
+    }
+    static constexpr index_type unravel(size_t flat)
+    {
+        index_type res{};
+        for (size_t a = rank; a-- > 0;)
+        {
+            res[a] = flat % extent(a);
+            flat /= extent(a);
+        }
+        return res;
+    }
+
+    template <typename... I> constexpr T &operator()(I... idx)
+    {
+        static_assert(sizeof...(I) == rank, "mdarray needs one index per dimension");
+        return data_[flat_index({static_cast<size_t>(idx)...})];
+    }
+    template <typename... I> constexpr const T &operator()(I... idx) const
+    {
+        static_assert(sizeof...(I) == rank, "mdarray needs one index per dimension");
+        return data_[flat_index({static_cast<size_t>(idx)...})];
+    }
+    constexpr T &operator[](const index_type &idx) { return data_[flat_index(idx)]; }
+    constexpr const T &operator[](const index_type &idx) const { return data_[flat_index(idx)]; }
+
+    constexpr T *data() { return data_.data(); }
+    constexpr const T *data() const { return data_.data(); }
+    constexpr storage_type &flat() { return data_; }
+    constexpr const storage_type &flat() const { return data_; }
+
+    constexpr iterator begin() { return data_.begin(); }
+    constexpr iterator end() { return data_.end(); }
+    constexpr const_iterator begin() const { return data_.begin(); }
+    constexpr const_iterator end() const { return data_.end(); }
+
+    // The elements along Axis through the point `at`, whose Axis coordinate is ignored
+    template <size_t Axis> constexpr strided_span<T> line(index_type at)
+    {
+        static_assert(Axis < rank);
+        at[Axis] = 0;
+        return {data_.data() + flat_index(at), stride(Axis), extent(Axis)};
+    }
+    template <size_t Axis> constexpr strided_span<const T> line(index_type at) const
+    {
+        static_assert(Axis < rank);
+        at[Axis] = 0;
+        return {data_.data() + flat_index(at), stride(Axis), extent(Axis)};
+    }
+
+    // The contiguous last-axis run at the given leading indices
+    template <typename... I> constexpr T *row_data(I... lead)
+    {
+        static_assert(sizeof...(I) + 1 == rank, "row takes every index but the last");
+        return data_.data() + flat_index({static_cast<size_t>(lead)..., 0});
+    }
+    template <typename... I> constexpr const T *row_data(I... lead) const
+    {
+        static_assert(sizeof...(I) + 1 == rank, "row takes every index but the last");
+        return data_.data() + flat_index({static_cast<size_t>(lead)..., 0});
+    }
+    template <typename... I> constexpr strided_span<T> row(I... lead)
+    {
+        return {row_data(lead...), 1, extent(rank - 1)};
+    }
+    template <typename... I> constexpr strided_span<const T> row(I... lead) const
+    {
+        return {row_data(lead...), 1, extent(rank - 1)};
+    }
+
+    // Column c of a two dimensional array
+    constexpr strided_span<T> column(size_t c)
+    {
+        static_assert(rank == 2, "column is for two dimensional arrays; see line");
+        return line<0>({0, c});
+    }
+    constexpr strided_span<const T> column(size_t c) const
+    {
+        static_assert(rank == 2, "column is for two dimensional arrays; see line");
+        return line<0>({0, c});
+    }
+
+  private:
+    storage_type data_;
+};
+
+/**
+ * Build an mdarray<T, Dims...> by calling maker(i0, i1, ...) with the size_t index along each
+ * dimension, element by element in storage order. This is one make_array_lambda over the flat
+ * index, rather than a make_array_lambda per row, so a grid costs a single instantiation and
+ * large grids take make_array's loop path. It is constexpr when the maker is.
+ */
+template <typename T, size_t... Dims, typename Maker>
+constexpr mdarray<T, Dims...> make_array_nd(Maker &&maker)
+{
+    using md_t = mdarray<T, Dims...>;
+    // size_t, not auto: the pack path's integral_constant indices convert to it, so this
+    // lambda and the unravel in it are instantiated once rather than once per element
+    return md_t(make_array_lambda<T, md_t::size()>(
+        [&maker](size_t flat) { return std::apply(maker, md_t::unravel(flat)); }));
+}
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_MDARRAY_H
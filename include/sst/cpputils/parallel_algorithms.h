@@ -0,0 +1,109 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_PARALLEL_ALGORITHMS_H
+#define INCLUDE_SST_CPPUTILS_PARALLEL_ALGORITHMS_H
+
+/*
+ * The ThreadPool backed overloads of the algorithms in algorithms.h. They live apart so that
+ * plain contains and find users don't pull in <thread> or need to link a threads library;
+ * targets including this header link Threads::Threads themselves.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "algorithms.h"
+#include "thread_pool.h"
+
+namespace sst
+{
+namespace cpputils
+{
+
+/**
+ * Execution policy for the parallel overloads below. Work runs on `pool`, or on
+ * ThreadPool::shared() if that is null. Ranges shorter than `serial_threshold` elements are
+ * not worth waking threads for and run serially on the caller.
+ */
+struct parallel_t
+{
+    ThreadPool *pool{nullptr};
+    size_t serial_threshold{4096};
+};
+
+/** The default parallel policy, as in `contains_if(sst::cpputils::parallel, v, pred)`. */
+inline constexpr parallel_t parallel{};
+
+/**
+ * Parallel contains_if for random access ranges with an expensive predicate. The range is
+ * split into chunks across the thread pool; as soon as any worker finds a match it raises a
+ * shared flag and every worker stops at its next element. Non random access containers, and
+ * ranges below the policy's threshold, take the serial path.
+ *
+ * The predicate is called concurrently from several threads, so must be safe to do so.
+ */
+template <class ContainerType, class UnaryPredicate>
+bool contains_if(const parallel_t &policy, const ContainerType &container, UnaryPredicate q)
+{
+    using iter_t = decltype(std::begin(container));
+    constexpr bool randomAccess = std::is_base_of_v<
+        std::random_access_iterator_tag, typename std::iterator_traits<iter_t>::iterator_category>;
+
+    if constexpr (!randomAccess)
+    {
+        return contains_if(container, q);
+    }
+    else
+    {
+        auto b = std::begin(container);
+        auto n = static_cast<size_t>(std::end(container) - b);
+        if (n < std::max<size_t>(policy.serial_threshold, 2))
+            return contains_if(container, q);
+
+        auto &pool = policy.pool ? *policy.pool : ThreadPool::shared();
+        if (pool.concurrency() < 2)
+            return contains_if(container, q);
+
+        // A few chunks per thread so that a slow chunk doesn't hold the others up
+        auto chunks = std::min(n, pool.concurrency() * 4);
+        auto per = (n + chunks - 1) / chunks;
+        std::atomic<bool> found{false};
+
+        pool.parallel_for(chunks, [&](size_t c) {
+            auto from = c * per, to = std::min(n, from + per);
+            for (auto i = from; i < to; ++i)
+            {
+                if (found.load(std::memory_order_relaxed))
+                    return;
+                if (q(b[i]))
+                {
+                    found.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        });
+        return found.load();
+    }
+}
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_PARALLEL_ALGORITHMS_H
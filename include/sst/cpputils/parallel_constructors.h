@@ -0,0 +1,140 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_PARALLEL_CONSTRUCTORS_H
+#define INCLUDE_SST_CPPUTILS_PARALLEL_CONSTRUCTORS_H
+
+/*
+ * The ThreadPool backed builders next to make_array_lambda in constructors.h. They live apart
+ * so that plain make_array users don't pull in <thread>; targets including this header link
+ * Threads::Threads themselves.
+ */
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "constructors.h"
+#include "thread_pool.h"
+
+namespace sst::cpputils
+{
+namespace detail
+{
+// Construct storage[0, n) as T{maker(i)} across the pool. If any maker throws, the elements
+// which were built are destroyed before the exception is rethrown.
+template <typename T, typename Maker>
+void parallel_construct(T *storage, size_t n, Maker &maker, ThreadPool &pool)
+{
+    // one flag per element, each written by one thread only, read after parallel_for joins
+    std::unique_ptr<bool[]> built(new bool[n]());
+    try
+    {
+        pool.parallel_for(n, [&](size_t i) {
+            ::new (static_cast<void *>(storage + i)) T{maker(i)};
+            built[i] = true;
+        });
+    }
+    catch (...)
+    {
+        for (size_t i = 0; i < n; ++i)
+            if (built[i])
+                storage[i].~T();
+        throw;
+    }
+}
+} // namespace detail
+
+/**
+ * Like make_array_lambda, but calling maker(size_t index) for the elements concurrently on a
+ * ThreadPool, for arrays of heavyweight objects whose constructors allocate and precompute.
+ * Elements are constructed in place in uninitialized, suitably aligned heap storage and then
+ * moved into the returned array, so T must be movable but need not be default constructible.
+ *
+ * The maker is called from several threads at once, so it must be safe to do so. If it throws,
+ * every element already constructed is destroyed and the first exception is rethrown; nothing
+ * leaks and no partial result escapes.
+ *
+ * ```
+ * auto voices = sst::cpputils::make_array_parallel<Voice, 256>(
+ *     [&](size_t i) { return Voice(i, sampleRate); });
+ * ```
+ */
+template <typename T, size_t N, typename Maker>
+std::array<T, N> make_array_parallel(Maker &&maker, ThreadPool &pool = ThreadPool::shared())
+{
+    static_assert(std::is_move_constructible_v<T>, "make_array_parallel moves its result out");
+    union storage_t
+    {
+        std::array<T, N> arr;
+        storage_t() {}
+        ~storage_t() {}
+    };
+    auto st = std::make_unique<storage_t>();
+    detail::parallel_construct(st->arr.data(), N, maker, pool);
+
+    struct destroy_t
+    {
+        storage_t &st;
+        ~destroy_t()
+        {
+            for (auto &e : st.arr)
+                e.~T();
+        }
+    } destroy{*st};
+    return std::move(st->arr);
+}
+
+/**
+ * make_array_parallel for a run time count, returning a std::vector<T> of n elements.
+ */
+template <typename T, typename Maker>
+std::vector<T> make_vector_parallel(size_t n, Maker &&maker,
+                                    ThreadPool &pool = ThreadPool::shared())
+{
+    static_assert(std::is_move_constructible_v<T>, "make_vector_parallel moves its result out");
+    struct buffer_t
+    {
+        T *data;
+        size_t built{0};
+        explicit buffer_t(size_t n)
+            : data(static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)})))
+        {
+        }
+        ~buffer_t()
+        {
+            for (size_t i = 0; i < built; ++i)
+                data[i].~T();
+            ::operator delete(data, std::align_val_t{alignof(T)});
+        }
+    } buf(n);
+
+    detail::parallel_construct(buf.data, n, maker, pool);
+    buf.built = n;
+
+    std::vector<T> res;
+    res.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        res.push_back(std::move(buf.data[i]));
+    return res;
+}
+} // namespace sst::cpputils
+
+#endif // INCLUDE_SST_CPPUTILS_PARALLEL_CONSTRUCTORS_H
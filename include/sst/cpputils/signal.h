@@ -0,0 +1,277 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_SIGNAL_H
+#define INCLUDE_SST_CPPUTILS_SIGNAL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "bindings.h"
+#include "inplace_function.h"
+
+namespace sst
+{
+namespace cpputils
+{
+/**
+ * A handle to one slot of a signal, returned by connect. It is a plain value which may be
+ * copied around and dropped without effect; disconnect removes the slot. The signal must
+ * outlive every disconnect call. See scoped_connection to disconnect automatically.
+ */
+class connection
+{
+  public:
+    connection() = default;
+
+    // Returns true if this removed the slot, false if it was already gone.
+    bool disconnect()
+    {
+        if (!owner)
+            return false;
+        auto res = disconnectFn(owner, id);
+        owner = nullptr;
+        return res;
+    }
+
+    explicit operator bool() const { return owner != nullptr; }
+
+  private:
+    template <typename, size_t> friend class signal;
+    connection(void *o, uint64_t i, bool (*fn)(void *, uint64_t))
+        : owner(o), id(i), disconnectFn(fn)
+    {
+    }
+
+    void *owner{nullptr};
+    uint64_t id{0};
+    bool (*disconnectFn)(void *, uint64_t){nullptr};
+};
+
+/**
+ * A connection which disconnects when it goes out of scope, for listeners which are shorter
+ * lived than the signal they listen to.
+ */
+class scoped_connection
+{
+  public:
+    scoped_connection() = default;
+    scoped_connection(connection c) : conn(c) {}
+    scoped_connection(scoped_connection &&o) noexcept : conn(std::exchange(o.conn, {})) {}
+    scoped_connection &operator=(scoped_connection &&o) noexcept
+    {
+        if (&o != this)
+        {
+            conn.disconnect();
+            conn = std::exchange(o.conn, {});
+        }
+        return *this;
+    }
+    scoped_connection(const scoped_connection &) = delete;
+    scoped_connection &operator=(const scoped_connection &) = delete;
+    ~scoped_connection() { conn.disconnect(); }
+
+    bool disconnect() { return conn.disconnect(); }
+    // Give up ownership, leaving the slot connected
+    connection release() { return std::exchange(conn, {}); }
+
+  private:
+    connection conn;
+};
+
+template <typename Sig, size_t SlotCapacity = 4 * sizeof(void *)> class signal;
+
+/**
+ * A signal fanning notifications out to any number of slots, which may be emitted from the
+ * audio thread while other threads connect and disconnect.
+ *
+ * The slots live in an immutable snapshot, published through an atomic pointer. emit counts
+ * itself in as a reader, loads the current snapshot, calls every slot and counts itself out:
+ * it is wait-free, takes no lock and never allocates, since each slot is an
+ * inplace_function<void(Args...), SlotCapacity>. connect and disconnect are serialized by a
+ * mutex; they copy the snapshot, change the copy and publish it, then retire the old one. A
+ * retired snapshot is freed by a later connect or disconnect (or collect) which sees no emit in
+ * progress, so on a signal which is emitted continuously reclamation is delayed, not unsafe.
+ *
+ * A slot disconnected during an emit on another thread may be called by that emit once more.
+ *
+ * ```
+ * sst::cpputils::signal<void(int, float)> paramChanged;
+ * auto c = paramChanged.connect<&Editor::onParamChanged>(editor);
+ * paramChanged.emit(id, value);
+ * c.disconnect();
+ * ```
+ */
+template <typename... Args, size_t SlotCapacity> class signal<void(Args...), SlotCapacity>
+{
+  public:
+    using slot_type = inplace_function<void(Args...), SlotCapacity>;
+
+    signal() = default;
+    signal(const signal &) = delete;
+    signal &operator=(const signal &) = delete;
+
+    // Destroying a signal while it is being emitted or connected to is an error.
+    ~signal()
+    {
+        delete current.load();
+        for (auto *s : retired)
+            delete s;
+    }
+
+    template <typename F> connection connect(F &&f)
+    {
+        std::lock_guard<std::mutex> g(writeLock);
+        auto id = ++lastId;
+        auto *old = current.load();
+        auto next = std::make_unique<Snapshot>();
+        if (old)
+        {
+            next->slots.reserve(old->slots.size() + 1);
+            next->slots.insert(next->slots.end(), old->slots.begin(), old->slots.end());
+        }
+        next->slots.push_back(Slot{id, slot_type(std::forward<F>(f))});
+        publish(next.release());
+        return connection(this, id, &disconnectThunk);
+    }
+
+    // Connect a member function of obj, which must outlive the connection
+    template <auto Func, typename T> connection connect(T &obj)
+    {
+        return connect(bind_front<Func>(std::addressof(obj)));
+    }
+
+    template <typename... A> void emit(A &&...args) const
+    {
+        readers.fetch_add(1);
+        if (auto *s = current.load())
+        {
+            for (auto &slot : s->slots)
+                slot.fn(args...);
+        }
+        readers.fetch_sub(1);
+    }
+    template <typename... A> void operator()(A &&...args) const
+    {
+        emit(std::forward<A>(args)...);
+    }
+
+    bool disconnect(const connection &c)
+    {
+        return c.owner == this && removeSlot(c.id);
+    }
+
+    void disconnect_all()
+    {
+        std::lock_guard<std::mutex> g(writeLock);
+        if (current.load())
+            publish(nullptr);
+    }
+
+    // The number of connected slots, which may change as soon as it is returned
+    size_t size() const
+    {
+        readers.fetch_add(1);
+        auto *s = current.load();
+        auto res = s ? s->slots.size() : 0;
+        readers.fetch_sub(1);
+        return res;
+    }
+    bool empty() const { return size() == 0; }
+
+    // Free retired snapshots if no emit is running, and return how many are still held
+    size_t collect()
+    {
+        std::lock_guard<std::mutex> g(writeLock);
+        reclaim();
+        return retired.size();
+    }
+
+  private:
+    struct Slot
+    {
+        uint64_t id;
+        slot_type fn;
+    };
+    struct Snapshot
+    {
+        std::vector<Slot> slots;
+    };
+
+    static bool disconnectThunk(void *self, uint64_t id)
+    {
+        return static_cast<signal *>(self)->removeSlot(id);
+    }
+
+    bool removeSlot(uint64_t id)
+    {
+        std::lock_guard<std::mutex> g(writeLock);
+        auto *old = current.load();
+        if (!old)
+            return false;
+        auto &os = old->slots;
+        auto pos = std::find_if(os.begin(), os.end(), [id](auto &s) { return s.id == id; });
+        if (pos == os.end())
+            return false;
+
+        Snapshot *next{nullptr};
+        if (os.size() > 1)
+        {
+            next = new Snapshot();
+            next->slots.reserve(os.size() - 1);
+            for (auto it = os.begin(); it != os.end(); ++it)
+                if (it != pos)
+                    next->slots.push_back(*it);
+        }
+        publish(next);
+        return true;
+    }
+
+    // Called with writeLock held. Readers count themselves in before loading current, so once
+    // the old snapshot is unpublished, seeing no readers means nobody can still hold it.
+    void publish(Snapshot *next)
+    {
+        if (auto *old = current.exchange(next))
+            retired.push_back(old);
+        reclaim();
+    }
+    void reclaim()
+    {
+        if (retired.empty() || readers.load() != 0)
+            return;
+        for (auto *s : retired)
+            delete s;
+        retired.clear();
+    }
+
+    std::atomic<Snapshot *> current{nullptr};
+    mutable std::atomic<size_t> readers{0};
+
+    std::mutex writeLock;
+    std::vector<Snapshot *> retired;
+    uint64_t lastId{0};
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_SIGNAL_H
@@ -0,0 +1,539 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_STATIC_VECTOR_H
+#define INCLUDE_SST_CPPUTILS_STATIC_VECTOR_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace sst
+{
+namespace cpputils
+{
+
+/*
+ * static_vector is a vector with a fixed capacity N held inline in the object, for bounded
+ * per-block collections (events, voices) where we never want to touch the allocator.
+ * Elements are constructed into uninitialized storage, so T need not be default
+ * constructible, and the API is std::vector's minus everything to do with growth.
+ *
+ * Exceeding the capacity is a programming error. push_back, emplace_back, insert and resize
+ * assert on it; try_push_back and try_emplace_back return false instead, for callers which
+ * would rather drop an element. The data is contiguous, so contains uses its vectorized scan.
+ */
+template <typename T, size_t N> class static_vector
+{
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static_vector() = default;
+    explicit static_vector(size_type n) { resize(n); }
+    static_vector(size_type n, const T &v) { resize(n, v); }
+    static_vector(std::initializer_list<T> il) : static_vector(il.begin(), il.end()) {}
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    static_vector(It first, It last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    static_vector(const static_vector &other) : static_vector(other.begin(), other.end()) {}
+    static_vector(static_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        for (auto &v : other)
+            emplace_back(std::move(v));
+    }
+    static_vector &operator=(const static_vector &other)
+    {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+    static_vector &operator=(static_vector &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto &v : other)
+                emplace_back(std::move(v));
+        }
+        return *this;
+    }
+    static_vector &operator=(std::initializer_list<T> il)
+    {
+        assign(il.begin(), il.end());
+        return *this;
+    }
+    ~static_vector() { clear(); }
+
+    template <typename It> void assign(It first, It last)
+    {
+        clear();
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+    void assign(size_type n, const T &v)
+    {
+        clear();
+        resize(n, v);
+    }
+
+    // element access
+    reference operator[](size_type i)
+    {
+        assert(i < size_);
+        return data()[i];
+    }
+    const_reference operator[](size_type i) const
+    {
+        assert(i < size_);
+        return data()[i];
+    }
+    reference at(size_type i)
+    {
+        if (i >= size_)
+            throw std::out_of_range("static_vector::at");
+        return data()[i];
+    }
+    const_reference at(size_type i) const
+    {
+        if (i >= size_)
+            throw std::out_of_range("static_vector::at");
+        return data()[i];
+    }
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+    reference back() { return (*this)[size_ - 1]; }
+    const_reference back() const { return (*this)[size_ - 1]; }
+    T *data() noexcept { return reinterpret_cast<T *>(storage_); }
+    const T *data() const noexcept { return reinterpret_cast<const T *>(storage_); }
+
+    // iterators
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return data(); }
+    iterator end() noexcept { return data() + size_; }
+    const_iterator end() const noexcept { return data() + size_; }
+    const_iterator cend() const noexcept { return data() + size_; }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // capacity
+    bool empty() const noexcept { return size_ == 0; }
+    bool full() const noexcept { return size_ == N; }
+    size_type size() const noexcept { return size_; }
+    static constexpr size_type max_size() noexcept { return N; }
+    static constexpr size_type capacity() noexcept { return N; }
+
+    // modifiers
+    void clear() noexcept
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    template <typename... Args> reference emplace_back(Args &&...args)
+    {
+        assert(size_ < N);
+        auto p = ::new (static_cast<void *>(data() + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+    void push_back(const T &v) { emplace_back(v); }
+    void push_back(T &&v) { emplace_back(std::move(v)); }
+
+    template <typename... Args> bool try_emplace_back(Args &&...args)
+    {
+        if (size_ == N)
+            return false;
+        emplace_back(std::forward<Args>(args)...);
+        return true;
+    }
+    bool try_push_back(const T &v) { return try_emplace_back(v); }
+    bool try_push_back(T &&v) { return try_emplace_back(std::move(v)); }
+
+    void pop_back()
+    {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(data() + size_);
+    }
+
+    template <typename... Args> iterator emplace(const_iterator pos, Args &&...args)
+    {
+        auto idx = pos - begin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + idx, end() - 1, end());
+        return begin() + idx;
+    }
+    iterator insert(const_iterator pos, const T &v) { return emplace(pos, v); }
+    iterator insert(const_iterator pos, T &&v) { return emplace(pos, std::move(v)); }
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    iterator insert(const_iterator pos, It first, It last)
+    {
+        auto idx = pos - begin();
+        auto oldSize = size_;
+        for (; first != last; ++first)
+            emplace_back(*first);
+        std::rotate(begin() + idx, begin() + oldSize, end());
+        return begin() + idx;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto f = begin() + (first - begin());
+        auto l = begin() + (last - begin());
+        if (f != l)
+        {
+            auto newEnd = std::move(l, end(), f);
+            std::destroy(newEnd, end());
+            size_ -= static_cast<size_type>(l - f);
+        }
+        return f;
+    }
+
+    void resize(size_type n)
+    {
+        assert(n <= N);
+        while (size_ > n)
+            pop_back();
+        while (size_ < n)
+            emplace_back();
+    }
+    void resize(size_type n, const T &v)
+    {
+        assert(n <= N);
+        while (size_ > n)
+            pop_back();
+        while (size_ < n)
+            emplace_back(v);
+    }
+
+    void swap(static_vector &other)
+    {
+        static_vector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    friend bool operator==(const static_vector &a, const static_vector &b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+    friend bool operator!=(const static_vector &a, const static_vector &b) { return !(a == b); }
+
+  private:
+    alignas(T) unsigned char storage_[N == 0 ? 1 : N * sizeof(T)];
+    size_type size_{0};
+};
+
+/*
+ * small_vector keeps up to N elements inline, like static_vector, and only moves its
+ * contents to the heap once it grows past N. Use it where a collection is nearly always small
+ * but has no hard bound. Once spilled it stays on the heap (clear() and shrinking keep the
+ * allocation) until shrink_to_fit() brings it back inline.
+ *
+ * Growth moves elements, so as with std::vector a T which can throw on move only gets the
+ * basic exception guarantee when the buffer grows.
+ */
+template <typename T, size_t N> class small_vector
+{
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    small_vector() = default;
+    explicit small_vector(size_type n) { resize(n); }
+    small_vector(size_type n, const T &v) { resize(n, v); }
+    small_vector(std::initializer_list<T> il) : small_vector(il.begin(), il.end()) {}
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    small_vector(It first, It last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    small_vector(const small_vector &other) : small_vector(other.begin(), other.end()) {}
+    small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        takeFrom(std::move(other));
+    }
+    small_vector &operator=(const small_vector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size());
+            for (auto &v : other)
+                emplace_back(v);
+        }
+        return *this;
+    }
+    small_vector &operator=(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            release();
+            takeFrom(std::move(other));
+        }
+        return *this;
+    }
+    ~small_vector() { release(); }
+
+    // element access
+    reference operator[](size_type i)
+    {
+        assert(i < size_);
+        return data_[i];
+    }
+    const_reference operator[](size_type i) const
+    {
+        assert(i < size_);
+        return data_[i];
+    }
+    reference at(size_type i)
+    {
+        if (i >= size_)
+            throw std::out_of_range("small_vector::at");
+        return data_[i];
+    }
+    const_reference at(size_type i) const
+    {
+        if (i >= size_)
+            throw std::out_of_range("small_vector::at");
+        return data_[i];
+    }
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+    reference back() { return (*this)[size_ - 1]; }
+    const_reference back() const { return (*this)[size_ - 1]; }
+    T *data() noexcept { return data_; }
+    const T *data() const noexcept { return data_; }
+
+    // iterators
+    iterator begin() noexcept { return data_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator cbegin() const noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+    const_iterator cend() const noexcept { return data_ + size_; }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // capacity
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool is_inline() const noexcept { return data_ == inlineData(); }
+    static constexpr size_type inline_capacity() noexcept { return N; }
+
+    void reserve(size_type n)
+    {
+        if (n > capacity_)
+            reallocate(n);
+    }
+    void shrink_to_fit()
+    {
+        if (is_inline() || size_ == capacity_)
+            return;
+        reallocate(std::max(size_, N));
+    }
+
+    // modifiers
+    void clear() noexcept
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    template <typename... Args> reference emplace_back(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            // construct first, in case args alias an element we are about to move
+            T tmp(std::forward<Args>(args)...);
+            reallocate(std::max<size_type>(capacity_ * 2, 1));
+            auto p = ::new (static_cast<void *>(data_ + size_)) T(std::move(tmp));
+            ++size_;
+            return *p;
+        }
+        auto p = ::new (static_cast<void *>(data_ + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+    void push_back(const T &v) { emplace_back(v); }
+    void push_back(T &&v) { emplace_back(std::move(v)); }
+
+    void pop_back()
+    {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    template <typename... Args> iterator emplace(const_iterator pos, Args &&...args)
+    {
+        auto idx = pos - begin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + idx, end() - 1, end());
+        return begin() + idx;
+    }
+    iterator insert(const_iterator pos, const T &v) { return emplace(pos, v); }
+    iterator insert(const_iterator pos, T &&v) { return emplace(pos, std::move(v)); }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto f = begin() + (first - begin());
+        auto l = begin() + (last - begin());
+        if (f != l)
+        {
+            auto newEnd = std::move(l, end(), f);
+            std::destroy(newEnd, end());
+            size_ -= static_cast<size_type>(l - f);
+        }
+        return f;
+    }
+
+    void resize(size_type n)
+    {
+        reserve(n);
+        while (size_ > n)
+            pop_back();
+        while (size_ < n)
+            emplace_back();
+    }
+    void resize(size_type n, const T &v)
+    {
+        reserve(n);
+        while (size_ > n)
+            pop_back();
+        while (size_ < n)
+            emplace_back(v);
+    }
+
+    friend bool operator==(const small_vector &a, const small_vector &b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+    friend bool operator!=(const small_vector &a, const small_vector &b) { return !(a == b); }
+
+  private:
+    T *inlineData() noexcept { return reinterpret_cast<T *>(storage_); }
+    const T *inlineData() const noexcept { return reinterpret_cast<const T *>(storage_); }
+
+    // Move everything to a buffer of capacity n, inline if it fits. Elements whose move may
+    // throw are copied instead, as std::vector does, so a throw leaves the vector unchanged.
+    void reallocate(size_type n)
+    {
+        auto wasInline = is_inline();
+        T *dest = n <= N ? inlineData() : std::allocator<T>().allocate(n);
+        if (dest == data_)
+            return;
+        try
+        {
+            if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                          !std::is_copy_constructible_v<T>)
+                std::uninitialized_move(begin(), end(), dest);
+            else
+                std::uninitialized_copy(begin(), end(), dest);
+        }
+        catch (...)
+        {
+            if (n > N)
+                std::allocator<T>().deallocate(dest, n);
+            throw;
+        }
+        std::destroy(begin(), end());
+        if (!wasInline)
+            std::allocator<T>().deallocate(data_, capacity_);
+        data_ = dest;
+        capacity_ = n <= N ? N : n;
+    }
+
+    void release() noexcept
+    {
+        clear();
+        if (!is_inline())
+            std::allocator<T>().deallocate(data_, capacity_);
+        data_ = inlineData();
+        capacity_ = N;
+    }
+
+    // Steal a heap buffer, or move element by element out of an inline one.
+    void takeFrom(small_vector &&other)
+    {
+        if (other.is_inline())
+        {
+            for (auto &v : other)
+                emplace_back(std::move(v));
+            other.clear();
+        }
+        else
+        {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+    alignas(T) unsigned char storage_[N == 0 ? 1 : N * sizeof(T)];
+    T *data_{inlineData()};
+    size_type size_{0};
+    size_type capacity_{N};
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_STATIC_VECTOR_H
@@ -0,0 +1,188 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_THREAD_POOL_H
+#define INCLUDE_SST_CPPUTILS_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sst
+{
+namespace cpputils
+{
+
+/*
+ * A small fixed-size pool of worker threads for the parallel algorithms in this library.
+ * It is meant for offline and startup work (database scans, constructing large arrays),
+ * not the audio thread: submitting work locks a mutex and allocates. It is not part of
+ * sst/cpputils.h; targets including it, or the parallel_* headers, link Threads::Threads.
+ *
+ * The one operation is parallel_for, which runs fn(0) ... fn(count - 1) across the workers
+ * and the calling thread and returns when all of them are done. Since the caller takes
+ * indices too, a parallel_for issued from inside a worker cannot deadlock. If any fn throws,
+ * the remaining indices are skipped and the first exception is rethrown on the caller.
+ *
+ * ```
+ * sst::cpputils::ThreadPool pool(4);
+ * pool.parallel_for(chunks, [&](size_t c) { process(c); });
+ * ```
+ */
+class ThreadPool
+{
+  public:
+    // 0 threads means one per hardware thread, less the one which calls parallel_for.
+    explicit ThreadPool(size_t threads = 0)
+    {
+        if (threads == 0)
+            threads = std::max(1U, std::thread::hardware_concurrency()) - 1;
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; ++i)
+            workers_.emplace_back([this]() { workerLoop(); });
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> g(lock_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // The number of threads which work on a parallel_for, including the caller.
+    size_t concurrency() const { return workers_.size() + 1; }
+
+    template <typename F> void parallel_for(size_t count, F &&fn)
+    {
+        if (count == 0)
+            return;
+
+        auto job = std::make_shared<Job>();
+        job->count = count;
+        job->fn = std::ref(fn);
+
+        auto helpers = std::min(workers_.size(), count - 1);
+        if (helpers > 0)
+        {
+            {
+                std::lock_guard<std::mutex> g(lock_);
+                for (size_t i = 0; i < helpers; ++i)
+                    queue_.emplace_back([job]() { job->run(); });
+            }
+            cv_.notify_all();
+        }
+
+        job->run();
+
+        {
+            std::unique_lock<std::mutex> g(job->lock);
+            job->cv.wait(g, [&job]() { return job->done.load() == job->count; });
+        }
+        if (job->error)
+            std::rethrow_exception(job->error);
+    }
+
+    // A process-wide pool, created on first use, sized to the hardware.
+    static ThreadPool &shared()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+  private:
+    // Helpers may still be dequeued after parallel_for has returned, so they share ownership
+    // of the job and simply find no indices left.
+    struct Job
+    {
+        size_t count{0};
+        std::function<void(size_t)> fn;
+        std::atomic<size_t> next{0}, done{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex lock;
+        std::condition_variable cv;
+
+        void run()
+        {
+            size_t i;
+            while ((i = next.fetch_add(1)) < count)
+            {
+                if (!failed.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        fn(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> g(lock);
+                        if (!error)
+                            error = std::current_exception();
+                        failed = true;
+                    }
+                }
+                if (done.fetch_add(1) + 1 == count)
+                {
+                    std::lock_guard<std::mutex> g(lock);
+                    cv.notify_all();
+                }
+            }
+        }
+    };
+
+    void workerLoop()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> g(lock_);
+                cv_.wait(g, [this]() { return stopping_ || !queue_.empty(); });
+                if (stopping_ && queue_.empty())
+                    return;
+                task = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> queue_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    bool stopping_{false};
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_THREAD_POOL_H
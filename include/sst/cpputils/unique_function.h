@@ -0,0 +1,125 @@
+/*
+ * sst-cpputils - an open source library of things we needed in C++
+ * built by Surge Synth Team.
+ *
+ * Provides a collection of tools useful for writing C++-17 code
+ *
+ * Copyright 2022-2024, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-cpputils is released under the MIT License found in the "LICENSE"
+ * file in the root of this repository
+ *
+ * All source in sst-cpputils available at
+ * https://github.com/surge-synthesizer/sst-cpputils
+ */
+
+#ifndef INCLUDE_SST_CPPUTILS_UNIQUE_FUNCTION_H
+#define INCLUDE_SST_CPPUTILS_UNIQUE_FUNCTION_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "inplace_function.h"
+
+namespace sst
+{
+namespace cpputils
+{
+template <typename Sig, size_t Capacity = 4 * sizeof(void *)> class unique_function;
+
+/**
+ * A move-only std::function, in the spirit of C++23's std::move_only_function, so it can hold
+ * callables which own move-only state: a lambda capturing a std::unique_ptr, or a bind_front
+ * over an owned buffer, with no shared_ptr needed to get them into a std::function.
+ *
+ * Callables up to Capacity bytes which are nothrow movable are stored inline, as in
+ * inplace_unique_function; larger ones are moved to the heap, so unlike inplace_function any
+ * callable fits. Calling an empty unique_function throws std::bad_function_call.
+ *
+ * ```
+ * sst::cpputils::unique_function<void()> job =
+ *     sst::cpputils::bind_front(&writeFile, std::move(ownedBuffer));
+ * ```
+ */
+template <typename R, typename... Args, size_t Capacity>
+class unique_function<R(Args...), Capacity>
+{
+    using storage_t = inplace_unique_function<R(Args...), Capacity>;
+
+    template <typename D> struct heap_box
+    {
+        std::unique_ptr<D> target;
+        R operator()(Args... args)
+        {
+            if constexpr (std::is_void_v<R>)
+                std::invoke(*target, std::forward<Args>(args)...);
+            else
+                return std::invoke(*target, std::forward<Args>(args)...);
+        }
+    };
+
+    template <typename D>
+    static constexpr bool fitsInline = sizeof(D) <= Capacity &&
+                                       storage_t::alignment() % alignof(D) == 0 &&
+                                       std::is_nothrow_move_constructible_v<D>;
+
+    template <typename F, typename D = std::decay_t<F>> static storage_t wrap(F &&f)
+    {
+        if constexpr (fitsInline<D>)
+            return storage_t(std::forward<F>(f));
+        else
+            return storage_t(heap_box<D>{std::make_unique<D>(std::forward<F>(f))});
+    }
+
+  public:
+    using result_type = R;
+
+    unique_function() noexcept = default;
+    unique_function(std::nullptr_t) noexcept {}
+
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, unique_function> &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    unique_function(F &&f) : fn(wrap(std::forward<F>(f)))
+    {
+    }
+
+    unique_function(unique_function &&) noexcept = default;
+    unique_function &operator=(unique_function &&) noexcept = default;
+    unique_function &operator=(std::nullptr_t) noexcept
+    {
+        fn = nullptr;
+        return *this;
+    }
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, unique_function> &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    unique_function &operator=(F &&f)
+    {
+        fn = wrap(std::forward<F>(f));
+        return *this;
+    }
+
+    R operator()(Args... args) const { return fn(std::forward<Args>(args)...); }
+
+    explicit operator bool() const noexcept { return static_cast<bool>(fn); }
+    friend bool operator==(const unique_function &f, std::nullptr_t) noexcept { return !f; }
+    friend bool operator!=(const unique_function &f, std::nullptr_t) noexcept
+    {
+        return static_cast<bool>(f);
+    }
+
+    void swap(unique_function &o) noexcept { fn.swap(o.fn); }
+
+  private:
+    storage_t fn;
+};
+
+} // namespace cpputils
+} // namespace sst
+
+#endif // INCLUDE_SST_CPPUTILS_UNIQUE_FUNCTION_H
@@ -17,11 +17,56 @@
 #include "catch2.hpp"
 
 #include <sst/cpputils.h>
+#include <sst/cpputils/parallel_algorithms.h>
+#include <sst/cpputils/parallel_constructors.h>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bitset>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+// Counts every call to the global operator new, so tests can show a code path does not allocate,
+// and every delete of a real pointer, so they can show it does not leak
+static std::atomic<size_t> globalNewCalls{0};
+static std::atomic<size_t> globalDeleteCalls{0};
+
+void *operator new(size_t n)
+{
+    ++globalNewCalls;
+    if (auto *p = std::malloc(n ? n : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void *operator new(size_t n, const std::nothrow_t &) noexcept
+{
+    ++globalNewCalls;
+    return std::malloc(n ? n : 1);
+}
+void operator delete(void *p) noexcept
+{
+    if (p)
+        ++globalDeleteCalls;
+    std::free(p);
+}
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
 
 TEST_CASE("Enumerate")
 {
@@ -175,6 +220,138 @@ TEST_CASE("Zip")
     }
 }
 
+TEST_CASE("Prefetching")
+{
+    SECTION("Visits Everything In Order")
+    {
+        auto check = [](const auto &c, size_t distance) {
+            auto it = c.begin();
+            size_t ct{0};
+            for (const auto &v : sst::cpputils::prefetching(c, distance))
+            {
+                REQUIRE(it != c.end());
+                REQUIRE(v == *it);
+                ++it;
+                ct++;
+            }
+            REQUIRE(ct == c.size());
+        };
+        std::list<int> l{1, 2, 3, 4, 5, 6, 7};
+        check(l, 0);
+        check(l, 1);
+        check(l, 3);
+        check(l, 100);
+        check(std::list<int>(), 4);
+
+        std::map<int, std::string> m{{1, "one"}, {2, "two"}, {3, "three"}};
+        check(m, 2);
+    }
+
+    SECTION("Mutable Access")
+    {
+        std::list<int> l{1, 2, 3, 4};
+        for (auto &v : sst::cpputils::prefetching(l, 2))
+        {
+            v *= 10;
+        }
+        REQUIRE(l == std::list<int>{10, 20, 30, 40});
+    }
+
+    SECTION("Enumerate Prefetching Map")
+    {
+        std::map<int, int> m;
+        for (int i = 0; i < 32; ++i)
+            m[i] = i * 3;
+
+        for (const auto [idx, p] : sst::cpputils::enumerate(sst::cpputils::prefetching(m, 4)))
+        {
+            REQUIRE(p.first == (int)idx);
+            REQUIRE(p.second == (int)idx * 3);
+        }
+    }
+}
+
+TEST_CASE("Strided Span")
+{
+    std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    sst::cpputils::strided_span<int> evens(v.data(), 2, 6);
+    REQUIRE(evens.size() == 6);
+    REQUIRE(evens[5] == 10);
+    REQUIRE(std::distance(evens.begin(), evens.end()) == 6);
+    for (const auto [idx, val] : sst::cpputils::enumerate(evens))
+    {
+        REQUIRE(val == (int)idx * 2);
+    }
+    REQUIRE(*std::find(evens.begin(), evens.end(), 8) == 8);
+    REQUIRE(std::find(evens.begin(), evens.end(), 7) == evens.end());
+
+    std::fill(evens.begin(), evens.end(), -1);
+    REQUIRE(v[0] == -1);
+    REQUIRE(v[1] == 1);
+    REQUIRE(v[10] == -1);
+}
+
+TEST_CASE("Interleave")
+{
+    SECTION("Interleaved View")
+    {
+        std::vector<float> buf{0, 1, 10, 11, 20, 21, 30, 31};
+        auto view = sst::cpputils::interleaved_view(buf.data(), 2, 4);
+        REQUIRE(view.size() == 8);
+        REQUIRE(view(1, 2) == 21);
+        REQUIRE(view.frame(3)[0] == 30);
+
+        for (const auto &[l, r] : sst::cpputils::zip(view.channel(0), view.channel(1)))
+        {
+            REQUIRE(l + 1 == r);
+        }
+        for (auto [l, r] : sst::cpputils::zip(view.channel(0), view.channel(1)))
+        {
+            std::swap(l, r);
+        }
+        REQUIRE(buf == std::vector<float>{1, 0, 11, 10, 21, 20, 31, 30});
+    }
+
+    SECTION("Round Trip")
+    {
+        auto roundTrip = [](auto zero, size_t channels, size_t frames) {
+            using T = decltype(zero);
+            std::vector<std::vector<T>> planar(channels, std::vector<T>(frames));
+            std::vector<T *> ptrs;
+            for (size_t c = 0; c < channels; ++c)
+            {
+                for (size_t f = 0; f < frames; ++f)
+                    planar[c][f] = (T)(c * 1000 + f);
+                ptrs.push_back(planar[c].data());
+            }
+
+            std::vector<T> inter(channels * frames);
+            sst::cpputils::interleave(ptrs.data(), inter.data(), channels, frames);
+            auto view = sst::cpputils::interleaved_view(inter.data(), channels, frames);
+            for (size_t c = 0; c < channels; ++c)
+                for (size_t f = 0; f < frames; ++f)
+                    REQUIRE(view(c, f) == planar[c][f]);
+
+            std::vector<std::vector<T>> back(channels, std::vector<T>(frames));
+            std::vector<T *> backPtrs;
+            for (auto &b : back)
+                backPtrs.push_back(b.data());
+            sst::cpputils::deinterleave(view, backPtrs.data());
+            REQUIRE(back == planar);
+        };
+
+        for (size_t channels : {1, 2, 3, 4, 6, 8})
+        {
+            for (size_t frames : {0, 1, 3, 4, 17, 64})
+            {
+                roundTrip(0.f, channels, frames);
+                roundTrip(0.0, channels, frames);
+                roundTrip(0, channels, frames);
+            }
+        }
+    }
+}
+
 TEST_CASE("Contains")
 {
     SECTION("Simple Vector")
@@ -226,6 +403,273 @@ TEST_CASE("Contains")
         REQUIRE(!sst::cpputils::contains_if(
             m, [](const auto &pair) { return pair.second == "not_a_value"; }));
     }
+
+    SECTION("Associative Containers Use Their Lookup")
+    {
+        std::map<std::string, int> m{{"hi", 1}, {"zoo", 2}};
+        REQUIRE(sst::cpputils::contains(m, "hi"));
+        REQUIRE(sst::cpputils::contains(m, std::string("zoo")));
+        REQUIRE(!sst::cpputils::contains(m, "there"));
+        // a full pair still falls back to a scan
+        using vt = std::map<std::string, int>::value_type;
+        REQUIRE(sst::cpputils::contains(m, vt{"zoo", 2}));
+        REQUIRE(!sst::cpputils::contains(m, vt{"zoo", 3}));
+
+        std::set<int> s{1, 4, 9};
+        REQUIRE(sst::cpputils::contains(s, 4));
+        REQUIRE(!sst::cpputils::contains(s, 5));
+
+        std::unordered_map<int, std::string> um{{7, "seven"}};
+        REQUIRE(sst::cpputils::contains(um, 7));
+        REQUIRE(!sst::cpputils::contains(um, 8));
+
+        std::unordered_set<std::string> us{"a", "b"};
+        REQUIRE(sst::cpputils::contains(us, std::string("b")));
+        REQUIRE(!sst::cpputils::contains(us, std::string("c")));
+
+        // A lookup type which counts comparisons, to prove we are not scanning
+        struct Counted
+        {
+            int v;
+            int *ct;
+            bool operator<(const Counted &o) const
+            {
+                (*ct)++;
+                return v < o.v;
+            }
+        };
+        int ct{0};
+        std::set<Counted> cs;
+        for (int i = 0; i < 1024; ++i)
+            cs.insert(Counted{i, &ct});
+        ct = 0;
+        REQUIRE(sst::cpputils::contains(cs, Counted{1000, &ct}));
+        REQUIRE(ct < 64);
+    }
+
+    SECTION("Assume Sorted")
+    {
+        std::vector<int> v{1, 3, 5, 7, 9, 11};
+        REQUIRE(sst::cpputils::contains(sst::cpputils::assume_sorted(v), 7));
+        REQUIRE(!sst::cpputils::contains(sst::cpputils::assume_sorted(v), 8));
+        REQUIRE(!sst::cpputils::contains(sst::cpputils::assume_sorted(std::vector<int>()), 8));
+
+        std::vector<int> desc{9, 7, 5, 3};
+        auto sd = sst::cpputils::assume_sorted(desc, std::greater<>());
+        REQUIRE(sst::cpputils::contains(sd, 5));
+        REQUIRE(!sst::cpputils::contains(sd, 4));
+        static_assert(sst::cpputils::is_sorted_range_v<decltype(sd)>);
+        static_assert(!sst::cpputils::is_sorted_range_v<std::vector<int>>);
+    }
+
+    SECTION("Vectorized Contiguous Scan")
+    {
+        auto scan = [](auto zero) {
+            using T = decltype(zero);
+            // every length and position around the register widths, to cover the tails
+            for (size_t n = 0; n < 70; ++n)
+            {
+                std::vector<T> v(n);
+                for (size_t i = 0; i < n; ++i)
+                    v[i] = (T)(i + 1);
+                REQUIRE(!sst::cpputils::contains(v, (T)0));
+                REQUIRE(!sst::cpputils::contains(v, (T)(n + 1)));
+                for (size_t i = 0; i < n; ++i)
+                {
+                    REQUIRE(sst::cpputils::contains(v, (T)(i + 1)));
+                    REQUIRE(sst::cpputils::find(v, (T)(i + 1)) == v.begin() + i);
+                }
+                REQUIRE(sst::cpputils::find(v, (T)0) == v.end());
+            }
+        };
+        scan((char)0);
+        scan((uint8_t)0);
+        scan((int16_t)0);
+        scan((uint16_t)0);
+        scan((int32_t)0);
+        scan((uint32_t)0);
+        scan((int64_t)0);
+        scan(0.f);
+        scan(0.0);
+
+        // the first of several hits is the one found
+        std::vector<int> dup{5, 1, 2, 1, 2, 1, 2, 1, 2, 7, 7};
+        REQUIRE(sst::cpputils::find(dup, 7) == dup.begin() + 9);
+
+        std::array<float, 9> fl{1, 2, 3, 4, 5, 6, 7, -0.f, std::numeric_limits<float>::quiet_NaN()};
+        REQUIRE(sst::cpputils::contains(fl, 0.f));
+        REQUIRE(!sst::cpputils::contains(fl, std::numeric_limits<float>::quiet_NaN()));
+
+        // a differently typed needle keeps the scalar comparison semantics
+        std::vector<uint8_t> bytes{1, 2, 44};
+        REQUIRE(!sst::cpputils::contains(bytes, 300));
+        REQUIRE(sst::cpputils::contains(bytes, 44));
+
+        const std::string str = "hello world";
+        REQUIRE(sst::cpputils::find(str, 'w') == str.begin() + 6);
+    }
+
+#if SST_CPPUTILS_HAS_CONSTANT_EVALUATED
+    SECTION("Constant Expressions Skip The Vectorized Scan")
+    {
+        static constexpr std::array<int, 9> primes{2, 3, 5, 7, 11, 13, 17, 19, 23};
+        static_assert(sst::cpputils::contains(primes, 13));
+        static_assert(!sst::cpputils::contains(primes, 9));
+        static_assert(sst::cpputils::find(primes, 17) == primes.begin() + 6);
+        static_assert(sst::cpputils::find(primes, 4) == primes.end());
+
+        static constexpr std::array<char, 3> abc{'a', 'b', 'c'};
+        static_assert(sst::cpputils::contains(abc, 'b'));
+        REQUIRE(sst::cpputils::contains(primes, 23));
+    }
+#endif
+}
+
+TEST_CASE("Contains Many")
+{
+    std::vector<int> hay;
+    for (int i = 0; i < 5000; ++i)
+        hay.push_back(i * 2);
+
+    std::vector<int> needles;
+    for (int i = 0; i < 500; ++i)
+        needles.push_back(i * 7);
+    needles.push_back(14); // a duplicate
+    needles.push_back(-4);
+
+    auto expect = [&](const auto &bits) {
+        size_t ct{0};
+        for (size_t i = 0; i < needles.size(); ++i)
+        {
+            auto shouldHave = needles[i] >= 0 && needles[i] % 2 == 0 && needles[i] < 10000;
+            REQUIRE((bool)bits[i] == shouldHave);
+            ct += shouldHave;
+        }
+        return ct;
+    };
+
+    SECTION("Hashed Scan")
+    {
+        std::vector<bool> bits(needles.size());
+        auto found = sst::cpputils::contains_many(hay, needles, bits);
+        REQUIRE(found == expect(bits));
+    }
+
+    SECTION("Sorted Merge")
+    {
+        bool bits[502];
+        auto found = sst::cpputils::contains_many(sst::cpputils::assume_sorted(hay), needles, bits);
+        REQUIRE(found == expect(bits));
+    }
+
+    SECTION("Associative")
+    {
+        std::set<int> hs(hay.begin(), hay.end());
+        std::vector<bool> bits(needles.size());
+        auto found = sst::cpputils::contains_many(hs, needles, bits);
+        REQUIRE(found == expect(bits));
+    }
+
+    SECTION("Few Needles")
+    {
+        std::bitset<3> bits;
+        REQUIRE(sst::cpputils::contains_many(hay, std::array<int, 3>{3, 4, 9998}, bits) == 2);
+        REQUIRE(bits.to_ulong() == 0b110);
+    }
+
+    SECTION("Ordered But Not Hashable")
+    {
+        struct Id
+        {
+            int v;
+            bool operator<(const Id &o) const { return v < o.v; }
+        };
+        std::vector<Id> ids, want;
+        for (int i = 0; i < 100; ++i)
+            ids.push_back({i * 3});
+        for (int i = 0; i < 20; ++i)
+            want.push_back({i * 5});
+        want.push_back({15});
+
+        auto res = sst::cpputils::contains_many(ids, want);
+        // 0, 15, 30, 45, 60, 75, 90 and the duplicate 15
+        REQUIRE(res == std::vector<size_t>{0, 3, 6, 9, 12, 15, 18, 20});
+    }
+
+    SECTION("Indices And Empties")
+    {
+        std::vector<std::string> words{"alpha", "beta", "gamma", "delta", "epsilon",
+                                       "zeta",  "eta",  "theta", "iota",  "kappa"};
+        std::vector<std::string> q{"eta", "pi", "alpha", "rho", "sigma", "tau",
+                                   "phi", "chi", "psi",   "kappa"};
+        REQUIRE(sst::cpputils::contains_many(words, q) == std::vector<size_t>{0, 2, 9});
+        REQUIRE(sst::cpputils::contains_many(std::vector<std::string>(), q).empty());
+        REQUIRE(sst::cpputils::contains_many(words, std::vector<std::string>()).empty());
+    }
+}
+
+TEST_CASE("Parallel Contains If")
+{
+    std::vector<int> v(100000);
+    for (size_t i = 0; i < v.size(); ++i)
+        v[i] = (int)i;
+
+    SECTION("Found And Not Found")
+    {
+        sst::cpputils::ThreadPool pool(3);
+        sst::cpputils::parallel_t policy{&pool, 1000};
+        REQUIRE(sst::cpputils::contains_if(policy, v, [](int x) { return x == 99999; }));
+        REQUIRE(sst::cpputils::contains_if(policy, v, [](int x) { return x == 0; }));
+        REQUIRE(sst::cpputils::contains_if(policy, v, [](int x) { return x == 54321; }));
+        REQUIRE(!sst::cpputils::contains_if(policy, v, [](int x) { return x < 0; }));
+
+        REQUIRE(sst::cpputils::contains_if(sst::cpputils::parallel, v,
+                                           [](int x) { return x == 77777; }));
+        REQUIRE(!sst::cpputils::contains_if(sst::cpputils::parallel, v,
+                                            [](int x) { return x == -1; }));
+    }
+
+    SECTION("Stops Early")
+    {
+        sst::cpputils::ThreadPool pool(3);
+        std::atomic<size_t> calls{0};
+        REQUIRE(sst::cpputils::contains_if(sst::cpputils::parallel_t{&pool, 1000}, v, [&](int x) {
+            calls++;
+            return x == 10;
+        }));
+        // each of the 16 chunks stops at or before its first element once the flag is raised
+        REQUIRE(calls < v.size() / 2);
+    }
+
+    SECTION("Serial Fallbacks")
+    {
+        std::vector<int> small{1, 2, 3};
+        REQUIRE(sst::cpputils::contains_if(sst::cpputils::parallel, small,
+                                           [](int x) { return x == 3; }));
+        std::list<int> l{1, 2, 3};
+        REQUIRE(sst::cpputils::contains_if(sst::cpputils::parallel, l,
+                                           [](int x) { return x == 2; }));
+        REQUIRE(!sst::cpputils::contains_if(sst::cpputils::parallel, std::vector<int>(),
+                                            [](int) { return true; }));
+    }
+
+    SECTION("Pool Propagates Exceptions")
+    {
+        sst::cpputils::ThreadPool pool(2);
+        std::atomic<int> ran{0};
+        REQUIRE_THROWS_AS(pool.parallel_for(64,
+                                            [&](size_t i) {
+                                                ran++;
+                                                if (i == 5)
+                                                    throw std::runtime_error("five");
+                                            }),
+                          std::runtime_error);
+        REQUIRE(ran <= 64);
+
+        std::vector<int> hits(64, 0);
+        pool.parallel_for(hits.size(), [&](size_t i) { hits[i]++; });
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }));
+    }
 }
 
 TEST_CASE("SimpleRingBuffer")
@@ -501,161 +945,1388 @@ TEST_CASE("Erase")
         REQUIRE(m[1].x == "there");
         REQUIRE(m.size() == 1);
     }
-}
-
-TEST_CASE("Bindings")
-{
 
-    struct Point
+    SECTION("Erased Count")
     {
-        int x = 0, y = 0;
+        std::vector<int> v;
+        for (int i = 0; i < 10000; ++i)
+            v.push_back(i);
+        REQUIRE(sst::cpputils::nodal_erase_if(v, [](int x) { return x % 3 == 0; }) == 3334);
+        REQUIRE(v.size() == 6666);
+        REQUIRE(v[0] == 1);
+        REQUIRE(v[1] == 2);
+        REQUIRE(v[2] == 4);
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+        REQUIRE(sst::cpputils::nodal_erase_if(v, [](int x) { return x < 0; }) == 0);
 
-        void displace(int x_off, int y_off)
-        {
-            x += x_off;
-            y += y_off;
-        }
-    };
+        std::deque<int> d{1, 2, 3, 4, 5, 6};
+        REQUIRE(sst::cpputils::nodal_erase_if(d, [](int x) { return x % 2 == 0; }) == 3);
+        REQUIRE(d == std::deque<int>{1, 3, 5});
 
-    SECTION("Bind Front Test")
-    {
-        const auto sum_func = [](int a, int b, int c, int d) { return a + b + c + d; };
-        const auto sum_two = sst::cpputils::bind_front(sum_func, 1, 2);
-        REQUIRE(sum_two(3, 4) == 10);
+        std::list<int> l{1, 2, 3, 4, 5, 6};
+        REQUIRE(sst::cpputils::nodal_erase_if(l, [](int x) { return x > 4; }) == 2);
+        REQUIRE(l == std::list<int>{1, 2, 3, 4});
+
+        std::map<int, int> m{{1, 1}, {2, 4}, {3, 9}};
+        REQUIRE(sst::cpputils::nodal_erase_if(m, [](auto &p) { return p.second > 3; }) == 2);
+        REQUIRE(m.size() == 1);
     }
 
-    SECTION("Bind Front Struct Test")
+    SECTION("Move Only Vector")
     {
-        Point p{};
-        auto displace = sst::cpputils::bind_front(&Point::displace, &p);
+        std::vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < 8; ++i)
+            v.push_back(std::make_unique<int>(i));
+        REQUIRE(sst::cpputils::nodal_erase_if(v, [](auto &p) { return *p % 2 == 1; }) == 4);
+        for (const auto &[idx, p] : sst::cpputils::enumerate(v))
+        {
+            REQUIRE(*p == (int)idx * 2);
+        }
+    }
+}
 
-        displace(3, 4);
+// Counts deallocations, across all rebinds, so we can show that extract_if never frees
+static int countingDeallocations{0};
+template <typename T> struct CountingAllocator
+{
+    using value_type = T;
 
-        REQUIRE(p.x == 3);
-        REQUIRE(p.y == 4);
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U> &) {}
+    T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, size_t n)
+    {
+        countingDeallocations++;
+        std::allocator<T>().deallocate(p, n);
     }
+    template <typename U> bool operator==(const CountingAllocator<U> &) const { return true; }
+    template <typename U> bool operator!=(const CountingAllocator<U> &) const { return false; }
+};
 
-    SECTION("Bind Back Test")
+TEST_CASE("Extract If")
+{
+    SECTION("Map Into Ring Buffer")
     {
-        const auto func = [](int a, int b, int c, int d) { return a + b - c - d; };
-        const auto sum_two = sst::cpputils::bind_back(func, 1, 2);
-        REQUIRE(sum_two(3, 4) == 4);
+        using map_t = std::map<int, std::string, std::less<>,
+                               CountingAllocator<std::pair<const int, std::string>>>;
+        map_t m;
+        for (int i = 0; i < 10; ++i)
+            m[i] = std::to_string(i);
+
+        sst::cpputils::SimpleRingBuffer<map_t::node_type, 16> gc;
+        countingDeallocations = 0;
+        auto ct = sst::cpputils::extract_if(
+            m, [](const auto &p) { return p.first % 2 == 1; },
+            [&gc](map_t::node_type &&n) { gc.push(std::move(n)); });
+
+        REQUIRE(ct == 5);
+        REQUIRE(m.size() == 5);
+        REQUIRE(countingDeallocations == 0);
+        REQUIRE(!sst::cpputils::contains(m, 3));
+
+        // and the "gc thread" frees them
+        auto nodes = gc.popall();
+        REQUIRE(nodes.size() == 5);
+        REQUIRE(nodes[0].key() == 1);
+        REQUIRE(nodes[4].mapped() == "9");
+        nodes.clear();
+        REQUIRE(countingDeallocations == 5);
     }
 
-    SECTION("Bind Back Struct Test")
+    SECTION("Unordered Set")
     {
-        auto displace_3_4 = sst::cpputils::bind_back(&Point::displace, 3, 4);
-
-        Point p{};
-        displace_3_4(&p);
+        std::unordered_set<int> s{1, 2, 3, 4, 5, 6};
+        std::vector<int> got;
+        auto ct = sst::cpputils::extract_if(
+            s, [](int x) { return x > 3; },
+            [&got](auto &&node) { got.push_back(node.value()); });
+        REQUIRE(ct == 3);
+        REQUIRE(s.size() == 3);
+        std::sort(got.begin(), got.end());
+        REQUIRE(got == std::vector<int>{4, 5, 6});
+    }
 
-        REQUIRE(p.x == 3);
-        REQUIRE(p.y == 4);
+    SECTION("List Splices")
+    {
+        using list_t = std::list<int, CountingAllocator<int>>;
+        list_t l{1, 2, 3, 4, 5}, graveyard;
+        countingDeallocations = 0;
+        REQUIRE(sst::cpputils::extract_if(l, [](int x) { return x % 2 == 0; }, graveyard) == 2);
+        REQUIRE(countingDeallocations == 0);
+        REQUIRE(l == list_t{1, 3, 5});
+        REQUIRE(graveyard == list_t{2, 4});
     }
 }
 
-TEST_CASE("LRU")
+TEST_CASE("Unordered Erase")
 {
-    SECTION("Key-constructed struct")
+    SECTION("Removes The Right Things")
     {
-        struct ts
+        for (int n = 0; n < 40; ++n)
         {
-            explicit ts(const int &k) : key(k) {}
-            int key;
-        };
+            for (int mod : {1, 2, 3, 7})
+            {
+                std::vector<int> v(n);
+                std::iota(v.begin(), v.end(), 0);
+                v.reserve(64);
+                auto cap = v.capacity();
 
-        sst::cpputils::LRU<int, ts> cache(3);
-        auto s1 = cache.get(1);
-        auto s2 = cache.get(2);
-        auto s3 = cache.get(3);
-        REQUIRE(s1->key == 1);
-        REQUIRE(s2->key == 2);
-        REQUIRE(s3->key == 3);
-        // Move s1 up to head.
-        cache.get(1);
-        // Should be two use counts for s1, s2, and s3, as they all should be in the cache.
-        REQUIRE(s1.use_count() == 2);
-        REQUIRE(s2.use_count() == 2);
-        REQUIRE(s3.use_count() == 2);
-        // Now get a new one, s4. The least recently used should be s2, so it should get evicted and
-        // the shared_ptr's use_count should drop to 1. The others should remain two.
-        cache.get(4);
-        REQUIRE(s1.use_count() == 2);
-        REQUIRE(s2.use_count() == 1);
-        REQUIRE(s3.use_count() == 2);
+                auto pred = [mod](int x) { return x % mod == 0; };
+                auto removed = sst::cpputils::unordered_erase_if(v, pred);
 
-        // The following will fail to compile.
-        // cache.get(1, 1, 2);
+                REQUIRE(removed == (size_t)(n + mod - 1) / mod);
+                REQUIRE(v.size() == (size_t)n - removed);
+                REQUIRE(v.capacity() == cap);
+                REQUIRE(!sst::cpputils::contains_if(v, pred));
+
+                std::sort(v.begin(), v.end());
+                REQUIRE(std::adjacent_find(v.begin(), v.end()) == v.end());
+            }
+        }
     }
 
-    SECTION("Multiple-constructed struct")
+    SECTION("Moves Rather Than Copies")
     {
-        struct ts3
+        std::vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < 10; ++i)
+            v.push_back(std::make_unique<int>(i));
+        REQUIRE(sst::cpputils::unordered_erase_if(v, [](auto &p) { return *p < 3; }) == 3);
+        REQUIRE(v.size() == 7);
+        int sum{0};
+        for (auto &p : v)
+            sum += *p;
+        REQUIRE(sum == 3 + 4 + 5 + 6 + 7 + 8 + 9);
+    }
+
+    SECTION("One Move Per Removal")
+    {
+        struct Counted
         {
-            ts3(int a, float b, const int &c) : a_(a), b_(b), c_(c) {}
-            int a_;
-            float b_;
-            int c_;
+            int v;
+            int *moves;
+            Counted(int vv, int *m) : v(vv), moves(m) {}
+            Counted(Counted &&o) noexcept : v(o.v), moves(o.moves) {}
+            Counted &operator=(Counted &&o) noexcept
+            {
+                v = o.v;
+                moves = o.moves;
+                (*moves)++;
+                return *this;
+            }
         };
-
-        sst::cpputils::LRU<int, ts3> cache(1);
-
-        // Just make sure the compilation works.
-        auto v = cache.get(1, 1, 2.f, 3);
-        REQUIRE(v->a_ == 1);
-        REQUIRE(v->c_ == 3);
-
-        // The following will fail to compile.
-        // cache.get(1);
+        int moves{0};
+        std::vector<Counted> v;
+        v.reserve(100);
+        for (int i = 0; i < 100; ++i)
+            v.emplace_back(i, &moves);
+        auto removed = sst::cpputils::unordered_erase_if(v, [](auto &c) { return c.v < 10; });
+        REQUIRE(removed == 10);
+        REQUIRE(moves <= 10);
     }
 }
 
-TEST_CASE("Array CTor")
+TEST_CASE("Radix Sort")
 {
-    struct NeedsArgs
+    struct Event
     {
-        int a, b;
-        NeedsArgs(int aa, int bb) : a(aa), b(bb) {}
-        int val() const { return a * 1000 + b; }
+        uint32_t frameOffset;
+        int order;
     };
+    auto byFrame = [](const Event &e) { return e.frameOffset; };
 
-    std::array<NeedsArgs, 20> arr{sst::cpputils::make_array<NeedsArgs, 20>(17, 42)};
-    for (const auto &a : arr)
+    SECTION("Stable Across Sizes")
     {
-        REQUIRE(a.val() == 17042);
+        std::mt19937 gen(17);
+        for (size_t n : {0, 1, 2, 5, 31, 32, 33, 100, 512, 3000})
+        {
+            for (uint32_t range : {4U, 256U, 70000U, 0xFFFFFFFFU})
+            {
+                std::vector<Event> ev(n), scratch(n);
+                for (size_t i = 0; i < n; ++i)
+                    ev[i] = Event{(uint32_t)(gen() % range), (int)i};
+                auto ref = ev;
+                std::stable_sort(ref.begin(), ref.end(), [](auto &a, auto &b) {
+                    return a.frameOffset < b.frameOffset;
+                });
+
+                sst::cpputils::radix_sort(ev, scratch, byFrame);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    REQUIRE(ev[i].frameOffset == ref[i].frameOffset);
+                    REQUIRE(ev[i].order == ref[i].order);
+                }
+            }
+        }
+    }
+
+    SECTION("Signed And Wide Keys")
+    {
+        std::vector<int64_t> v, scratch(200);
+        for (int i = 0; i < 200; ++i)
+            v.push_back((i % 2 ? -1 : 1) * (int64_t)i * 1000000007LL);
+        auto ref = v;
+        std::sort(ref.begin(), ref.end());
+        sst::cpputils::radix_sort(v.begin(), v.end(), scratch.begin(), [](auto x) { return x; });
+        REQUIRE(v == ref);
+
+        std::vector<int8_t> bytes, bScratch(256);
+        for (int i = 0; i < 256; ++i)
+            bytes.push_back((int8_t)(i * 37));
+        sst::cpputils::radix_sort(bytes, bScratch, [](auto x) { return x; });
+        REQUIRE(std::is_sorted(bytes.begin(), bytes.end()));
+        REQUIRE(bytes.front() == -128);
+        REQUIRE(bytes.back() == 127);
+    }
+
+    SECTION("Move Only Records")
+    {
+        std::vector<std::unique_ptr<int>> v, scratch(64);
+        for (int i = 0; i < 64; ++i)
+            v.push_back(std::make_unique<int>(63 - i));
+        sst::cpputils::radix_sort(v, scratch, [](const auto &p) { return *p; });
+        for (int i = 0; i < 64; ++i)
+            REQUIRE(*v[i] == i);
     }
 }
 
-TEST_CASE("Array Indexed CTor")
+TEST_CASE("Static Vector")
 {
-    struct NeedsArgs
+    SECTION("Basic API")
     {
-        int a, b;
-        NeedsArgs(int aa, int bb) : a(aa), b(bb) {}
-        int val() const { return a * 1000 + b; }
-    };
+        sst::cpputils::static_vector<int, 8> v{1, 2, 3};
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.capacity() == 8);
+        REQUIRE(v.front() == 1);
+        REQUIRE(v.back() == 3);
+        v.push_back(4);
+        v.emplace_back(5);
+        v.insert(v.begin(), 0);
+        REQUIRE(v == sst::cpputils::static_vector<int, 8>{0, 1, 2, 3, 4, 5});
+        v.erase(v.begin() + 1, v.begin() + 3);
+        REQUIRE(v == sst::cpputils::static_vector<int, 8>{0, 3, 4, 5});
+        v.pop_back();
+        REQUIRE(v.size() == 3);
+        REQUIRE_THROWS_AS(v.at(3), std::out_of_range);
+
+        v.resize(8, 7);
+        REQUIRE(v.full());
+        REQUIRE(!v.try_push_back(9));
+        REQUIRE(v.back() == 7);
+        v.clear();
+        REQUIRE(v.empty());
+        REQUIRE(v.try_push_back(9));
+    }
 
-    SECTION("Last Index")
+    SECTION("Non Default Constructible And Lifetimes")
     {
-        std::array<NeedsArgs, 20> arr{sst::cpputils::make_array_bind_last_index<NeedsArgs, 20>(17)};
-        for (const auto &[idx, a] : sst::cpputils::enumerate(arr))
+        struct Tracked
         {
-            REQUIRE(a.val() == 17000 + idx);
+            int *alive;
+            int v;
+            Tracked(int *a, int vv) : alive(a), v(vv) { (*alive)++; }
+            Tracked(const Tracked &o) : alive(o.alive), v(o.v) { (*alive)++; }
+            Tracked &operator=(const Tracked &) = default;
+            ~Tracked() { (*alive)--; }
+        };
+        int alive{0};
+        {
+            sst::cpputils::static_vector<Tracked, 16> v;
+            for (int i = 0; i < 10; ++i)
+                v.emplace_back(&alive, i);
+            REQUIRE(alive == 10);
+            auto w = v;
+            REQUIRE(alive == 20);
+            sst::cpputils::nodal_erase_if(w, [](auto &t) { return t.v % 2 == 0; });
+            REQUIRE(alive == 15);
+            sst::cpputils::unordered_erase_if(v, [](auto &t) { return t.v < 3; });
+            REQUIRE(alive == 12);
         }
+        REQUIRE(alive == 0);
     }
 
-    SECTION("First Index")
+    SECTION("Works With The Algorithms")
     {
-        std::array<NeedsArgs, 20> arr{
-            sst::cpputils::make_array_bind_first_index<NeedsArgs, 20>(23)};
-        for (const auto &[idx, a] : sst::cpputils::enumerate(arr))
+        sst::cpputils::static_vector<int, 64> v;
+        for (int i = 0; i < 40; ++i)
+            v.push_back(i * 3);
+        REQUIRE(sst::cpputils::contains(v, 39));
+        REQUIRE(!sst::cpputils::contains(v, 40));
+        REQUIRE(sst::cpputils::find(v, 39) == v.begin() + 13);
+        REQUIRE(sst::cpputils::nodal_erase_if(v, [](int x) { return x % 2 == 1; }) == 20);
+        for (const auto [idx, val] : sst::cpputils::enumerate(v))
         {
-            REQUIRE(a.val() == 1000 * idx + 23);
+            REQUIRE(val == (int)idx * 6);
+        }
+        for (const auto &[a, b] : sst::cpputils::zip(v, std::vector<int>{0, 6, 12}))
+        {
+            REQUIRE(a == b);
         }
     }
 }
 
-TEST_CASE("Array Lambda CTor")
+TEST_CASE("Small Vector")
+{
+    SECTION("Spills Past N")
+    {
+        sst::cpputils::small_vector<std::string, 4> v;
+        REQUIRE(v.is_inline());
+        for (int i = 0; i < 4; ++i)
+            v.push_back(std::to_string(i));
+        REQUIRE(v.is_inline());
+        v.push_back("4");
+        REQUIRE(!v.is_inline());
+        REQUIRE(v.capacity() >= 5);
+        for (int i = 5; i < 100; ++i)
+            v.emplace_back(std::to_string(i));
+        for (const auto [idx, val] : sst::cpputils::enumerate(v))
+        {
+            REQUIRE(val == std::to_string(idx));
+        }
+
+        sst::cpputils::nodal_erase_if(v, [](auto &s) { return s.size() > 1; });
+        REQUIRE(v.size() == 10);
+        v.shrink_to_fit();
+        REQUIRE(!v.is_inline());
+        v.resize(3);
+        v.shrink_to_fit();
+        REQUIRE(v.is_inline());
+        REQUIRE(v == sst::cpputils::small_vector<std::string, 4>{"0", "1", "2"});
+    }
+
+    SECTION("Copy And Move")
+    {
+        sst::cpputils::small_vector<std::unique_ptr<int>, 2> a;
+        a.push_back(std::make_unique<int>(1));
+        auto b = std::move(a);
+        REQUIRE(b.size() == 1);
+        REQUIRE(*b[0] == 1);
+        for (int i = 2; i < 6; ++i)
+            b.push_back(std::make_unique<int>(i));
+        auto heap = b.data();
+        auto c = std::move(b);
+        REQUIRE(c.data() == heap); // heap buffers are stolen, not copied
+        REQUIRE(c.size() == 5);
+        REQUIRE(*c.back() == 5);
+
+        sst::cpputils::small_vector<int, 3> d{1, 2, 3, 4, 5}, e;
+        e = d;
+        REQUIRE(e == d);
+        REQUIRE(sst::cpputils::contains(e, 5));
+        e.push_back(e[0]); // aliasing an element across a regrow
+        REQUIRE(e.back() == 1);
+    }
+
+    SECTION("Throwing Regrow Keeps The Old Buffer")
+    {
+        static bool armed{false};
+        struct Brittle
+        {
+            int v;
+            Brittle(int x) : v(x) {}
+            Brittle(const Brittle &o) : v(o.v)
+            {
+                if (armed)
+                    throw std::runtime_error("copy");
+            }
+            Brittle(Brittle &&o) noexcept(false) : Brittle(static_cast<const Brittle &>(o)) {}
+            Brittle &operator=(const Brittle &) = default;
+        };
+
+        sst::cpputils::small_vector<Brittle, 2> v;
+        v.emplace_back(1);
+        v.emplace_back(2);
+        v.reserve(4);
+        auto heap = v.data();
+        auto news = globalNewCalls.load(), deletes = globalDeleteCalls.load();
+        armed = true;
+        REQUIRE_THROWS_AS(v.reserve(64), std::runtime_error);
+        armed = false;
+        REQUIRE(globalNewCalls.load() - news == globalDeleteCalls.load() - deletes);
+        REQUIRE(v.data() == heap);
+        REQUIRE(v.capacity() == 4);
+        REQUIRE(v.size() == 2);
+        REQUIRE(v[1].v == 2);
+    }
+}
+
+TEST_CASE("Flat Set")
+{
+    auto exercise = [](auto proto) {
+        using set_t = decltype(proto);
+        set_t s{5, 1, 9, 3, 7, 3, 1};
+        REQUIRE(s.size() == 5);
+        REQUIRE(std::is_sorted(s.begin(), s.end()));
+        REQUIRE(s.contains(7));
+        REQUIRE(!s.contains(4));
+        REQUIRE(*s.lower_bound(4) == 5);
+        REQUIRE(s.lower_bound(10) == s.end());
+        REQUIRE(sst::cpputils::contains(s, 9));
+        REQUIRE(!sst::cpputils::contains(s, 10));
+
+        REQUIRE(s.insert(4).second);
+        REQUIRE(!s.insert(4).second);
+        REQUIRE(s.erase(1) == 1);
+        REQUIRE(s.erase(1) == 0);
+        REQUIRE(s == set_t{3, 4, 5, 7, 9});
+
+        // every size and every probe, against std::set
+        for (int n = 0; n < 70; ++n)
+        {
+            set_t fs;
+            std::set<int> ref;
+            for (int i = 0; i < n; ++i)
+            {
+                fs.insert(i * 3);
+                ref.insert(i * 3);
+            }
+            for (int probe = -1; probe < n * 3 + 2; ++probe)
+            {
+                REQUIRE(fs.contains(probe) == (ref.count(probe) == 1));
+                auto lb = fs.lower_bound(probe);
+                auto rlb = ref.lower_bound(probe);
+                REQUIRE((lb == fs.end()) == (rlb == ref.end()));
+                if (lb != fs.end())
+                    REQUIRE(*lb == *rlb);
+            }
+        }
+    };
+    exercise(sst::cpputils::flat_set<int>());
+    exercise(sst::cpputils::flat_set<int, std::less<int>, sst::cpputils::flat_layout::eytzinger>());
+
+    SECTION("Custom Compare")
+    {
+        sst::cpputils::flat_set<std::string, std::greater<std::string>> s{"b", "a", "c"};
+        REQUIRE(*s.begin() == "c");
+        REQUIRE(s.contains("a"));
+    }
+
+    SECTION("Throwing Bulk Insert Leaves The Set Alone")
+    {
+        static int comparesLeft{-1};
+        struct Touchy
+        {
+            bool operator()(const std::string &a, const std::string &b) const
+            {
+                if (comparesLeft >= 0 && comparesLeft-- == 0)
+                    throw std::runtime_error("compare");
+                return a < b;
+            }
+        };
+        auto check = [](auto proto) {
+            auto s = proto;
+            s.insert(std::string("d"));
+            s.insert(std::string("b"));
+            std::vector<std::string> more{"e", "a", "c", "b", "f"};
+            // fail at each comparison in turn, in the sort and in the merge
+            for (int fail = 0;; ++fail)
+            {
+                auto t = s;
+                comparesLeft = fail;
+                try
+                {
+                    t.insert(more.begin(), more.end());
+                    comparesLeft = -1;
+                    REQUIRE(t.size() == 6);
+                    break;
+                }
+                catch (const std::runtime_error &)
+                {
+                    comparesLeft = -1;
+                    REQUIRE(std::vector<std::string>(t.begin(), t.end()) ==
+                            std::vector<std::string>{"b", "d"});
+                    REQUIRE(t.contains("d"));
+                    REQUIRE(!t.contains("a"));
+                }
+            }
+        };
+        check(sst::cpputils::flat_set<std::string, Touchy>());
+        check(sst::cpputils::flat_set<std::string, Touchy,
+                                      sst::cpputils::flat_layout::eytzinger>());
+    }
+}
+
+TEST_CASE("Flat Map")
+{
+    auto exercise = [](auto proto) {
+        using map_t = decltype(proto);
+        map_t m{{3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+        REQUIRE(m.size() == 3);
+        REQUIRE(m.at(1) == "one");
+        REQUIRE(m.find(2)->second == "two");
+        REQUIRE(m.find(4) == m.end());
+        REQUIRE_THROWS_AS(m.at(4), std::out_of_range);
+        REQUIRE(sst::cpputils::contains(m, 3));
+        REQUIRE(!sst::cpputils::contains(m, 5));
+
+        m[4] = "four";
+        m[1] = "ein";
+        REQUIRE(m.insert_or_assign(2, "zwei").second == false);
+        REQUIRE(m.insert({0, "zero"}).second);
+        REQUIRE(m.keys() == std::vector<int>{0, 1, 2, 3, 4});
+
+        for (auto [k, v] : m)
+            v += "!";
+        for (const auto [idx, kv] : sst::cpputils::enumerate(m))
+        {
+            REQUIRE(kv.first == (int)idx);
+            REQUIRE(kv.second.back() == '!');
+        }
+        REQUIRE(m.at(1) == "ein!");
+
+        REQUIRE(m.erase(3) == 1);
+        m.erase(m.find(0));
+        REQUIRE(m.keys() == std::vector<int>{1, 2, 4});
+        REQUIRE(m.values() == std::vector<std::string>{"ein!", "zwei!", "four!"});
+
+        const auto &cm = m;
+        REQUIRE(cm.find(4)->second == "four!");
+        REQUIRE(std::distance(cm.begin(), cm.end()) == 3);
+    };
+    exercise(sst::cpputils::flat_map<int, std::string>());
+    exercise(sst::cpputils::flat_map<int, std::string, std::less<int>,
+                                     sst::cpputils::flat_layout::eytzinger>());
+
+    SECTION("Large Eytzinger Lookups")
+    {
+        std::vector<std::pair<int, int>> init;
+        for (int i = 0; i < 5000; ++i)
+            init.emplace_back(i * 7, i);
+        sst::cpputils::flat_map<int, int, std::less<int>, sst::cpputils::flat_layout::eytzinger> m(
+            init.begin(), init.end());
+        for (int i = 0; i < 5000 * 7; ++i)
+        {
+            auto it = m.find(i);
+            if (i % 7 == 0)
+            {
+                REQUIRE(it != m.end());
+                REQUIRE(it->second == i / 7);
+            }
+            else
+            {
+                REQUIRE(it == m.end());
+            }
+        }
+    }
+
+    SECTION("Bulk Insert Merges And Keeps The First")
+    {
+        sst::cpputils::flat_map<int, int> m{{2, 20}, {6, 60}};
+        std::vector<std::pair<int, int>> more{{7, 70}, {2, 0}, {1, 10}, {7, 0}, {4, 40}};
+        m.insert(more.begin(), more.end());
+        REQUIRE(m.keys() == std::vector<int>{1, 2, 4, 6, 7});
+        REQUIRE(m.values() == std::vector<int>{10, 20, 40, 60, 70});
+    }
+
+    SECTION("Bulk Insert Throwing Copy Leaves The Map Alone")
+    {
+        struct Fragile
+        {
+            std::string name;
+            bool throwOnCopy{false};
+            Fragile(std::string n, bool t = false) : name(std::move(n)), throwOnCopy(t) {}
+            Fragile(const Fragile &o) : name(o.name), throwOnCopy(o.throwOnCopy)
+            {
+                if (throwOnCopy)
+                    throw std::runtime_error("copy");
+            }
+            Fragile(Fragile &&) = default;
+            Fragile &operator=(const Fragile &) = default;
+            Fragile &operator=(Fragile &&) = default;
+        };
+        sst::cpputils::flat_map<std::string, Fragile> m;
+        m.try_emplace("b", "bee");
+        m.try_emplace("d", "dee");
+        std::vector<std::pair<std::string, Fragile>> more;
+        more.emplace_back("a", Fragile("ay"));
+        more.emplace_back("c", Fragile("see", true));
+        REQUIRE_THROWS_AS(m.insert(more.begin(), more.end()), std::runtime_error);
+        REQUIRE(m.keys() == std::vector<std::string>{"b", "d"});
+        REQUIRE(m.at("b").name == "bee");
+        REQUIRE(m.at("d").name == "dee");
+    }
+
+    SECTION("Proxy Iterator Category")
+    {
+        using it_t = sst::cpputils::flat_map<int, int>::iterator;
+        static_assert(std::is_same_v<std::iterator_traits<it_t>::iterator_category,
+                                     std::input_iterator_tag>);
+        static_assert(std::is_same_v<it_t::iterator_concept, std::random_access_iterator_tag>);
+        sst::cpputils::flat_map<int, int> m{{1, 1}, {2, 4}, {3, 9}};
+        REQUIRE(std::next(m.begin(), 2)->second == 9);
+        REQUIRE(m.begin()[1].second == 4);
+    }
+}
+
+TEST_CASE("Dense Bitset Set")
+{
+    SECTION("Membership")
+    {
+        sst::cpputils::dense_bitset_set<128> notes;
+        REQUIRE(notes.empty());
+        REQUIRE(notes.insert(60));
+        REQUIRE(!notes.insert(60));
+        REQUIRE(notes.insert(0));
+        REQUIRE(notes.insert(127));
+        REQUIRE(notes.insert(64));
+        REQUIRE(notes.size() == 4);
+        REQUIRE(notes.contains(64));
+        REQUIRE(!notes.contains(63));
+        REQUIRE(!notes.contains(1000));
+        REQUIRE(sst::cpputils::contains(notes, 127));
+        REQUIRE(!sst::cpputils::contains(notes, 126));
+
+        REQUIRE(notes.erase(60) == 1);
+        REQUIRE(notes.erase(60) == 0);
+        REQUIRE(notes.erase(1000) == 0);
+        REQUIRE(notes.size() == 3);
+        notes.clear();
+        REQUIRE(notes.empty());
+        REQUIRE(notes.begin() == notes.end());
+    }
+
+    SECTION("Iteration Matches std::set")
+    {
+        sst::cpputils::dense_bitset_set<200> s;
+        std::set<size_t> ref;
+        for (size_t i = 0; i < 200; i += 7)
+        {
+            s.insert(i);
+            ref.insert(i);
+        }
+        s.insert(199);
+        ref.insert(199);
+        REQUIRE(std::vector<size_t>(s.begin(), s.end()) ==
+                std::vector<size_t>(ref.begin(), ref.end()));
+        REQUIRE(*s.find(63) == 63);
+        REQUIRE(*std::next(s.find(63)) == 70);
+        REQUIRE(s.find(64) == s.end());
+        for (const auto [idx, v] : sst::cpputils::enumerate(s))
+        {
+            if (v != 199)
+                REQUIRE(v == idx * 7);
+        }
+    }
+
+    SECTION("Set Algebra")
+    {
+        using set_t = sst::cpputils::dense_bitset_set<130>;
+        set_t a{1, 2, 3, 65, 129}, b{2, 3, 4, 129};
+        REQUIRE((a | b) == set_t{1, 2, 3, 4, 65, 129});
+        REQUIRE((a & b) == set_t{2, 3, 129});
+        REQUIRE((a - b) == set_t{1, 65});
+        REQUIRE(a.intersects(b));
+        REQUIRE(!(a - b).intersects(b));
+    }
+
+    SECTION("Constexpr")
+    {
+        constexpr auto s = []() {
+            sst::cpputils::dense_bitset_set<16> r;
+            r.insert(3);
+            r.insert(9);
+            return r;
+        }();
+        static_assert(s.contains(9) && !s.contains(4));
+    }
+}
+
+TEST_CASE("Bindings")
+{
+
+    struct Point
+    {
+        int x = 0, y = 0;
+
+        void displace(int x_off, int y_off)
+        {
+            x += x_off;
+            y += y_off;
+        }
+    };
+
+    SECTION("Bind Front Test")
+    {
+        const auto sum_func = [](int a, int b, int c, int d) { return a + b + c + d; };
+        const auto sum_two = sst::cpputils::bind_front(sum_func, 1, 2);
+        REQUIRE(sum_two(3, 4) == 10);
+    }
+
+    SECTION("Bind Front Struct Test")
+    {
+        Point p{};
+        auto displace = sst::cpputils::bind_front(&Point::displace, &p);
+
+        displace(3, 4);
+
+        REQUIRE(p.x == 3);
+        REQUIRE(p.y == 4);
+    }
+
+    SECTION("Bind Back Test")
+    {
+        const auto func = [](int a, int b, int c, int d) { return a + b - c - d; };
+        const auto sum_two = sst::cpputils::bind_back(func, 1, 2);
+        REQUIRE(sum_two(3, 4) == 4);
+    }
+
+    SECTION("Bind Back Struct Test")
+    {
+        auto displace_3_4 = sst::cpputils::bind_back(&Point::displace, 3, 4);
+
+        Point p{};
+        displace_3_4(&p);
+
+        REQUIRE(p.x == 3);
+        REQUIRE(p.y == 4);
+    }
+
+    SECTION("Calls Do Not Copy Bound Arguments")
+    {
+        auto measure = [](const std::string &s, const std::vector<int> &v, size_t extra) {
+            return s.size() + v.size() + extra;
+        };
+        auto front = sst::cpputils::bind_front(measure, std::string(64, 'x'),
+                                               std::vector<int>(100, 1));
+        const auto back = sst::cpputils::bind_back(
+            [](size_t extra, const std::string &s) { return s.size() + extra; },
+            std::string(64, 'y'));
+
+        auto before = globalNewCalls.load();
+        size_t total{0};
+        for (size_t i = 0; i < 100; ++i)
+            total += front(i) + back(i);
+        REQUIRE(globalNewCalls.load() == before);
+        REQUIRE(total == 100 * (164 + 64) + 2 * 4950);
+    }
+
+    SECTION("Bound Arguments Are Owned Copies")
+    {
+        std::string name{"osc"};
+        auto append = sst::cpputils::bind_front(
+            [](std::string &s, const std::string &tail) { return s += tail; }, name);
+        name = "changed";
+
+        REQUIRE(append("1") == "osc1");
+        REQUIRE(append("2") == "osc12"); // the binder's own copy persists between calls
+        REQUIRE(name == "changed");
+
+        auto copy(append); // copying the binder copies its state
+        REQUIRE(copy("3") == "osc123");
+        REQUIRE(append("4") == "osc124");
+    }
+
+    SECTION("Call Arguments Are Forwarded")
+    {
+        auto sink = sst::cpputils::bind_back(
+            [](std::unique_ptr<int> p, int add) { return *p + add; }, 5);
+        REQUIRE(sink(std::make_unique<int>(37)) == 42);
+
+        int target{0};
+        auto ref = sst::cpputils::bind_front([](int &t, int v) -> int & { return t = v; });
+        ref(target, 3) += 1;
+        REQUIRE(target == 4);
+    }
+}
+
+TEST_CASE("Inplace Function")
+{
+    SECTION("Calls Without Allocating")
+    {
+        auto before = globalNewCalls.load();
+
+        int calls{0};
+        std::array<double, 3> gains{0.5, 0.25, 2.0};
+        sst::cpputils::inplace_function<double(int), 48> scaled = [&calls, gains](int i) {
+            ++calls;
+            return gains[i] * 4;
+        };
+        REQUIRE(scaled(0) == 2.0);
+        REQUIRE(scaled(2) == 8.0);
+
+        auto copy = scaled;
+        REQUIRE(copy(1) == 1.0);
+        REQUIRE(calls == 3);
+
+        struct Voice
+        {
+            float cutoff{0};
+            void setCutoff(float c) { cutoff = c; }
+        } voice;
+        sst::cpputils::inplace_function<void(float)> onChange =
+            sst::cpputils::bind_front(&Voice::setCutoff, &voice);
+        onChange(0.5f);
+        REQUIRE(voice.cutoff == 0.5f);
+
+        REQUIRE(globalNewCalls.load() == before);
+    }
+
+    SECTION("Empty And Reassigned")
+    {
+        sst::cpputils::inplace_function<int(int)> f;
+        REQUIRE(!f);
+        REQUIRE(f == nullptr);
+        REQUIRE_THROWS_AS(f(1), std::bad_function_call);
+
+        int (*nullFn)(int) = nullptr;
+        f = nullFn;
+        REQUIRE(!f);
+
+        f = [](int x) { return x * 2; };
+        REQUIRE(f);
+        REQUIRE(f(21) == 42);
+
+        sst::cpputils::inplace_function<int(int)> g = [](int x) { return x + 1; };
+        f.swap(g);
+        REQUIRE(f(1) == 2);
+        REQUIRE(g(1) == 2);
+
+        f = nullptr;
+        REQUIRE(f == nullptr);
+    }
+
+    SECTION("Copies Are Independent")
+    {
+        sst::cpputils::inplace_function<int()> counter = [n = 0]() mutable { return ++n; };
+        REQUIRE(counter() == 1);
+        auto other = counter;
+        REQUIRE(counter() == 2);
+        REQUIRE(other() == 2);
+        REQUIRE(other() == 3);
+        REQUIRE(counter() == 3);
+    }
+
+    SECTION("Callables Are Destroyed Once")
+    {
+        static int live{0};
+        struct Tracked
+        {
+            Tracked() { ++live; }
+            Tracked(const Tracked &) { ++live; }
+            Tracked(Tracked &&) noexcept { ++live; }
+            ~Tracked() { --live; }
+            int operator()() const { return live; }
+        };
+        {
+            sst::cpputils::inplace_function<int()> a = Tracked{};
+            REQUIRE(live == 1);
+            auto b = a;
+            auto c = std::move(a);
+            REQUIRE(live == 2);
+            REQUIRE(!a);
+            b = c;
+            REQUIRE(live == 2);
+            c = nullptr;
+            REQUIRE(live == 1);
+        }
+        REQUIRE(live == 0);
+    }
+
+    SECTION("Move Only Variant")
+    {
+        static_assert(!std::is_copy_constructible_v<sst::cpputils::inplace_unique_function<int()>>);
+        static_assert(std::is_copy_constructible_v<sst::cpputils::inplace_function<int()>>);
+
+        auto owned = std::make_unique<int>(7);
+        sst::cpputils::inplace_unique_function<int(int)> f = [p = std::move(owned)](int x) {
+            return *p * x;
+        };
+        REQUIRE(f(6) == 42);
+
+        auto g = std::move(f);
+        REQUIRE(!f);
+        REQUIRE(g(2) == 14);
+
+        sst::cpputils::inplace_unique_function<void(std::unique_ptr<int> &)> reset =
+            sst::cpputils::bind_back([](std::unique_ptr<int> &p, int v) { p.reset(new int(v)); },
+                                     9);
+        std::unique_ptr<int> target;
+        reset(target);
+        REQUIRE(*target == 9);
+    }
+
+    SECTION("Throwing Moves Are Boxed By unique_function")
+    {
+        // inplace_function rejects this with a static_assert, since its moves are noexcept
+        struct ThrowingMove
+        {
+            int v{5};
+            ThrowingMove() = default;
+            ThrowingMove(const ThrowingMove &) = default;
+            ThrowingMove(ThrowingMove &&o) noexcept(false) : v(o.v)
+            {
+                if (v < 0)
+                    throw std::runtime_error("move");
+            }
+            int operator()() const { return v; }
+        };
+        static_assert(!std::is_nothrow_move_constructible_v<ThrowingMove>);
+        static_assert(std::is_nothrow_move_constructible_v<sst::cpputils::inplace_function<int()>>);
+
+        auto before = globalNewCalls.load();
+        sst::cpputils::unique_function<int()> f = ThrowingMove{};
+        REQUIRE(globalNewCalls.load() > before);
+        auto g = std::move(f);
+        REQUIRE(!f);
+        REQUIRE(g() == 5);
+    }
+}
+
+static int sumOverIndices(sst::cpputils::function_ref<int(int)> fn, int n)
+{
+    int res{0};
+    for (int i = 0; i < n; ++i)
+        res += fn(i);
+    return res;
+}
+
+static int tripleIt(int x) { return 3 * x; }
+
+TEST_CASE("Function Ref")
+{
+    static_assert(sizeof(sst::cpputils::function_ref<int(int)>) == 2 * sizeof(void *));
+    static_assert(std::is_trivially_copyable_v<sst::cpputils::function_ref<int(int)>>);
+
+    SECTION("Lambdas And Binders")
+    {
+        std::vector<int> big(1000, 2);
+        auto before = globalNewCalls.load();
+
+        REQUIRE(sumOverIndices([&big](int i) { return big[i]; }, 10) == 20);
+
+        auto offset = sst::cpputils::bind_front([](int a, int b) { return a + b; }, 100);
+        REQUIRE(sumOverIndices(offset, 3) == 303);
+
+        REQUIRE(globalNewCalls.load() == before);
+    }
+
+    SECTION("Refers Rather Than Copies")
+    {
+        int calls{0};
+        auto counting = [&calls, n = 0](int) mutable {
+            ++calls;
+            return ++n;
+        };
+        sst::cpputils::function_ref<int(int)> ref = counting;
+        REQUIRE(ref(0) == 1);
+        REQUIRE(ref(0) == 2);
+        REQUIRE(counting(0) == 3); // the state advanced in the referenced lambda itself
+
+        auto copy = ref;
+        REQUIRE(copy(0) == 4);
+        REQUIRE(calls == 4);
+    }
+
+    SECTION("Functions And Conversions")
+    {
+        REQUIRE(sumOverIndices(tripleIt, 4) == 18);
+        REQUIRE(sumOverIndices(&tripleIt, 4) == 18);
+
+        // the result converts to R, and arguments are forwarded
+        auto deref = [](std::unique_ptr<int> p) { return *p; };
+        sst::cpputils::function_ref<double(std::unique_ptr<int>)> consume = deref;
+        REQUIRE(consume(std::make_unique<int>(5)) == 5.0);
+
+        std::string s;
+        auto appendString = [&s](const std::string &v) { s += v; };
+        sst::cpputils::function_ref<void(const char *)> append = appendString;
+        append("ab");
+        append("c");
+        REQUIRE(s == "abc");
+    }
+}
+
+TEST_CASE("Static Binding And Delegates")
+{
+    struct Filter
+    {
+        float cutoff{0}, res{0};
+        void set(float c, float r)
+        {
+            cutoff = c;
+            res = r;
+        }
+        float gain(float x) const { return x * 2; }
+    };
+
+    SECTION("Bind Front With Template Callable")
+    {
+        Filter f;
+        auto setCutoff = sst::cpputils::bind_front<&Filter::set>(&f);
+        static_assert(sizeof(setCutoff) == sizeof(Filter *));
+        setCutoff(0.5f, 0.25f);
+        REQUIRE(f.cutoff == 0.5f);
+        REQUIRE(f.res == 0.25f);
+
+        auto byRef = sst::cpputils::bind_front<&Filter::set>(std::ref(f), 0.1f);
+        byRef(0.9f);
+        REQUIRE(f.cutoff == 0.1f);
+        REQUIRE(f.res == 0.9f);
+    }
+
+    SECTION("Bind Back With Template Callable")
+    {
+        Filter f;
+        auto setResTo = sst::cpputils::bind_back<&Filter::set>(0.75f);
+        setResTo(f, 0.3f);
+        REQUIRE(f.cutoff == 0.3f);
+        REQUIRE(f.res == 0.75f);
+
+        const auto triple = sst::cpputils::bind_back<&tripleIt>();
+        REQUIRE(triple(5) == 15);
+    }
+
+    SECTION("Delegates")
+    {
+        Filter a, b;
+        using setter_t = sst::cpputils::delegate<void(float, float)>;
+
+        setter_t empty;
+        REQUIRE(!empty);
+        REQUIRE_THROWS_AS(empty(1, 2), std::bad_function_call);
+
+        auto da = setter_t::create<&Filter::set>(a);
+        auto db = setter_t::create<&Filter::set>(b);
+        REQUIRE(da);
+        da(1, 2);
+        db(3, 4);
+        REQUIRE(a.cutoff == 1);
+        REQUIRE(b.res == 4);
+
+        REQUIRE(da == setter_t::create<&Filter::set>(a));
+        REQUIRE(da != db);
+        REQUIRE(da != empty);
+
+        const Filter &ca = a;
+        auto gain = sst::cpputils::delegate<double(float)>::create<&Filter::gain>(ca);
+        REQUIRE(gain(3) == 6.0);
+
+        auto free = sst::cpputils::delegate<int(int)>::create<&tripleIt>();
+        REQUIRE(free(2) == 6);
+        static_assert(std::is_trivially_copyable_v<setter_t>);
+    }
+}
+
+TEST_CASE("Signal")
+{
+    SECTION("Connect Emit Disconnect")
+    {
+        sst::cpputils::signal<void(int, float)> changed;
+        REQUIRE(changed.empty());
+        changed.emit(1, 2.f); // nothing connected is fine
+
+        int sumIds{0};
+        float lastValue{0};
+        auto a = changed.connect([&sumIds](int id, float) { sumIds += id; });
+        auto b = changed.connect([&lastValue](int, float v) { lastValue = v; });
+        REQUIRE(changed.size() == 2);
+
+        changed.emit(3, 0.5f);
+        changed(4, 0.25f);
+        REQUIRE(sumIds == 7);
+        REQUIRE(lastValue == 0.25f);
+
+        REQUIRE(a.disconnect());
+        REQUIRE(!a.disconnect());
+        changed.emit(10, 1.f);
+        REQUIRE(sumIds == 7);
+        REQUIRE(lastValue == 1.f);
+
+        REQUIRE(changed.disconnect(b));
+        REQUIRE(changed.empty());
+        REQUIRE(changed.collect() == 0);
+    }
+
+    SECTION("Member Slots And Scoped Connections")
+    {
+        struct Editor
+        {
+            int seen{0};
+            void onChange(int v) { seen += v; }
+        } ed;
+
+        sst::cpputils::signal<void(int)> sig;
+        {
+            sst::cpputils::scoped_connection c = sig.connect<&Editor::onChange>(ed);
+            sig.emit(5);
+            REQUIRE(ed.seen == 5);
+        }
+        sig.emit(5);
+        REQUIRE(ed.seen == 5);
+
+        sst::cpputils::scoped_connection kept = sig.connect<&Editor::onChange>(ed);
+        auto raw = kept.release();
+        sig.emit(1);
+        REQUIRE(ed.seen == 6);
+        sig.disconnect_all();
+        sig.emit(1);
+        REQUIRE(ed.seen == 6);
+        REQUIRE(!raw.disconnect());
+    }
+
+    SECTION("Emit Does Not Allocate")
+    {
+        sst::cpputils::signal<void(const std::string &)> sig;
+        size_t total{0};
+        std::vector<sst::cpputils::connection> conns;
+        for (int i = 0; i < 8; ++i)
+            conns.push_back(sig.connect([&total](const std::string &s) { total += s.size(); }));
+        std::string msg{"cutoff"};
+
+        auto before = globalNewCalls.load();
+        for (int i = 0; i < 100; ++i)
+            sig.emit(msg);
+        REQUIRE(globalNewCalls.load() == before);
+        REQUIRE(total == 8 * 100 * msg.size());
+    }
+
+    SECTION("Concurrent Emit And Connect")
+    {
+        sst::cpputils::signal<void(int &)> sig;
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> emits{0}, badEmits{0};
+
+        auto permanent = sig.connect([](int &x) { x += 1; });
+        std::thread audio([&]() {
+            while (!stop)
+            {
+                int x{0};
+                sig.emit(x);
+                // the permanent slot always runs, the transient ones add at most 2
+                if (x < 1 || x > 3)
+                    ++badEmits;
+                ++emits;
+            }
+        });
+
+        for (int round = 0; round < 200; ++round)
+        {
+            std::vector<sst::cpputils::connection> conns;
+            for (int i = 0; i < 4; ++i)
+                conns.push_back(sig.connect([i](int &x) { x += i % 2; }));
+            for (auto &c : conns)
+                REQUIRE(c.disconnect());
+        }
+        while (emits < 100)
+            std::this_thread::yield();
+        stop = true;
+        audio.join();
+
+        REQUIRE(badEmits == 0);
+
+        REQUIRE(sig.size() == 1);
+        REQUIRE(sig.collect() == 0);
+        REQUIRE(permanent.disconnect());
+    }
+}
+
+TEST_CASE("Unique Function And Move Only Binders")
+{
+    SECTION("Binders Over Move Only State")
+    {
+        auto readOwned = [](const std::unique_ptr<int> &p, int add) { return *p + add; };
+        auto bound = sst::cpputils::bind_front(readOwned, std::make_unique<int>(40));
+        REQUIRE(bound(2) == 42);
+        REQUIRE(std::as_const(bound)(1) == 41);
+
+        // called as an rvalue, the binder moves its bound arguments out
+        auto take = [](std::unique_ptr<int> p, int add) { return *p + add; };
+        auto once = sst::cpputils::bind_front(take, std::make_unique<int>(7));
+        REQUIRE(std::move(once)(3) == 10);
+
+        auto takeBack = sst::cpputils::bind_back(
+            [](int mul, std::vector<int> v) { return v.size() * mul; }, std::vector<int>(5));
+        REQUIRE(std::move(takeBack)(2) == 10);
+
+        struct Sink
+        {
+            std::string got;
+            void consume(std::string s) { got = std::move(s); }
+        } sink;
+        auto consumer = sst::cpputils::bind_back<&Sink::consume>(std::string(100, 'z'));
+        consumer(sink); // as an lvalue the bound string is copied
+        REQUIRE(sink.got.size() == 100);
+        std::move(consumer)(sink);
+        REQUIRE(sink.got.size() == 100);
+    }
+
+    SECTION("Rvalue Qualified Callables")
+    {
+        struct Callable
+        {
+            int operator()() & { return 1; }
+            int operator()() const & { return 2; }
+            int operator()() && { return 3; }
+            int operator()() const && { return 4; }
+        };
+        auto b = sst::cpputils::bind_front(Callable{});
+        const auto &cb = b;
+        REQUIRE(b() == 1);
+        REQUIRE(cb() == 2);
+        REQUIRE(std::move(b)() == 3);
+        REQUIRE(std::move(cb)() == 4);
+    }
+
+    SECTION("Holds Move Only Callables")
+    {
+        sst::cpputils::unique_function<int(int)> f;
+        REQUIRE(!f);
+        REQUIRE_THROWS_AS(f(1), std::bad_function_call);
+
+        f = sst::cpputils::bind_front(
+            [](const std::unique_ptr<int> &p, int x) { return *p * x; }, std::make_unique<int>(6));
+        REQUIRE(f(7) == 42);
+
+        auto g = std::move(f);
+        REQUIRE(!f);
+        REQUIRE(g(2) == 12);
+        static_assert(!std::is_copy_constructible_v<decltype(g)>);
+
+        std::vector<sst::cpputils::unique_function<void()>> jobs;
+        int done{0};
+        for (int i = 0; i < 3; ++i)
+            jobs.emplace_back([&done, p = std::make_unique<int>(i)]() { done += *p; });
+        for (auto &j : jobs)
+            j();
+        REQUIRE(done == 3);
+    }
+
+    SECTION("Small Callables Stay Inline")
+    {
+        auto before = globalNewCalls.load();
+        auto owned = std::make_unique<int>(3);
+        sst::cpputils::unique_function<int()> small = [p = std::move(owned)]() { return *p; };
+        auto moved = std::move(small);
+        REQUIRE(moved() == 3);
+        REQUIRE(globalNewCalls.load() == before + 1); // just the make_unique
+    }
+
+    SECTION("Large Callables Go To The Heap")
+    {
+        static int live{0};
+        struct Big
+        {
+            std::array<double, 64> coeffs{};
+            std::unique_ptr<int> owned;
+            Big(int v) : owned(std::make_unique<int>(v)) { ++live; }
+            Big(Big &&o) noexcept : coeffs(o.coeffs), owned(std::move(o.owned)) { ++live; }
+            ~Big() { --live; }
+            int operator()(int i) const { return *owned + (int)coeffs[i]; }
+        };
+        {
+            sst::cpputils::unique_function<int(int)> f = Big(5);
+            REQUIRE(live == 1);
+            auto g = std::move(f);
+            REQUIRE(live == 1); // the box moved, not the callable
+            REQUIRE(g(10) == 5);
+            g = nullptr;
+            REQUIRE(live == 0);
+        }
+        REQUIRE(live == 0);
+    }
+}
+
+TEST_CASE("LRU")
+{
+    SECTION("Key-constructed struct")
+    {
+        struct ts
+        {
+            explicit ts(const int &k) : key(k) {}
+            int key;
+        };
+
+        sst::cpputils::LRU<int, ts> cache(3);
+        auto s1 = cache.get(1);
+        auto s2 = cache.get(2);
+        auto s3 = cache.get(3);
+        REQUIRE(s1->key == 1);
+        REQUIRE(s2->key == 2);
+        REQUIRE(s3->key == 3);
+        // Move s1 up to head.
+        cache.get(1);
+        // Should be two use counts for s1, s2, and s3, as they all should be in the cache.
+        REQUIRE(s1.use_count() == 2);
+        REQUIRE(s2.use_count() == 2);
+        REQUIRE(s3.use_count() == 2);
+        // Now get a new one, s4. The least recently used should be s2, so it should get evicted and
+        // the shared_ptr's use_count should drop to 1. The others should remain two.
+        cache.get(4);
+        REQUIRE(s1.use_count() == 2);
+        REQUIRE(s2.use_count() == 1);
+        REQUIRE(s3.use_count() == 2);
+
+        // The following will fail to compile.
+        // cache.get(1, 1, 2);
+    }
+
+    SECTION("Multiple-constructed struct")
+    {
+        struct ts3
+        {
+            ts3(int a, float b, const int &c) : a_(a), b_(b), c_(c) {}
+            int a_;
+            float b_;
+            int c_;
+        };
+
+        sst::cpputils::LRU<int, ts3> cache(1);
+
+        // Just make sure the compilation works.
+        auto v = cache.get(1, 1, 2.f, 3);
+        REQUIRE(v->a_ == 1);
+        REQUIRE(v->c_ == 3);
+
+        // The following will fail to compile.
+        // cache.get(1);
+    }
+}
+
+TEST_CASE("Array CTor")
+{
+    struct NeedsArgs
+    {
+        int a, b;
+        NeedsArgs(int aa, int bb) : a(aa), b(bb) {}
+        int val() const { return a * 1000 + b; }
+    };
+
+    std::array<NeedsArgs, 20> arr{sst::cpputils::make_array<NeedsArgs, 20>(17, 42)};
+    for (const auto &a : arr)
+    {
+        REQUIRE(a.val() == 17042);
+    }
+}
+
+TEST_CASE("Array Indexed CTor")
+{
+    struct NeedsArgs
+    {
+        int a, b;
+        NeedsArgs(int aa, int bb) : a(aa), b(bb) {}
+        int val() const { return a * 1000 + b; }
+    };
+
+    SECTION("Last Index")
+    {
+        std::array<NeedsArgs, 20> arr{sst::cpputils::make_array_bind_last_index<NeedsArgs, 20>(17)};
+        for (const auto &[idx, a] : sst::cpputils::enumerate(arr))
+        {
+            REQUIRE(a.val() == 17000 + idx);
+        }
+    }
+
+    SECTION("First Index")
+    {
+        std::array<NeedsArgs, 20> arr{
+            sst::cpputils::make_array_bind_first_index<NeedsArgs, 20>(23)};
+        for (const auto &[idx, a] : sst::cpputils::enumerate(arr))
+        {
+            REQUIRE(a.val() == 1000 * idx + 23);
+        }
+    }
+}
+
+TEST_CASE("Array Lambda CTor")
 {
     struct NeedsArgs
     {
@@ -673,6 +2344,459 @@ TEST_CASE("Array Lambda CTor")
     }
 }
 
+TEST_CASE("Large Array CTor")
+{
+    constexpr size_t bigN = 4096;
+    static_assert(bigN > sst::cpputils::detail::makeArrayPackLimit);
+
+    SECTION("Default Constructible Stays Constexpr")
+    {
+        static constexpr auto table =
+            sst::cpputils::make_array_lambda<int, bigN>([](size_t i) { return (int)(i * 3); });
+        static_assert(table[0] == 0);
+        static_assert(table[bigN - 1] == 3 * (int)(bigN - 1));
+
+        constexpr auto filled = sst::cpputils::make_array<double, 1000>(0.5);
+        static_assert(filled[999] == 0.5);
+
+        struct Gain
+        {
+            double g{1};
+            constexpr Gain() = default;
+            constexpr Gain(double x) : g(x) {}
+        };
+        static_assert(!std::is_trivially_default_constructible_v<Gain>);
+        constexpr auto gains = sst::cpputils::make_array<Gain, 1000>(0.25);
+        static_assert(gains[999].g == 0.25);
+    }
+
+    SECTION("Not Default Constructible")
+    {
+        struct NeedsArgs
+        {
+            int a, b;
+            NeedsArgs(int aa, int bb) : a(aa), b(bb) {}
+        };
+
+        auto same = sst::cpputils::make_array<NeedsArgs, 300>(1, 2);
+        auto last = sst::cpputils::make_array_bind_last_index<NeedsArgs, 300>(7);
+        auto first = sst::cpputils::make_array_bind_first_index<NeedsArgs, 300>(9);
+        auto lambda = sst::cpputils::make_array_lambda<NeedsArgs, 300>(
+            [](size_t i) { return NeedsArgs{(int)i, -(int)i}; });
+        for (size_t i = 0; i < 300; ++i)
+        {
+            REQUIRE(same[i].b == 2);
+            REQUIRE(last[i].a == 7);
+            REQUIRE(last[i].b == (int)i);
+            REQUIRE(first[i].a == (int)i);
+            REQUIRE(first[i].b == 9);
+            REQUIRE(lambda[i].b == -(int)i);
+        }
+    }
+
+    SECTION("Partial Failure Destroys Built Elements")
+    {
+        static int live{0};
+        struct Voice
+        {
+            std::vector<float> buffer;
+            Voice(size_t idx) : buffer(16)
+            {
+                if (idx == 400)
+                    throw std::runtime_error("no voice");
+                ++live;
+            }
+            Voice(Voice &&o) noexcept : buffer(std::move(o.buffer)) { ++live; }
+            ~Voice() { --live; }
+        };
+
+        REQUIRE_THROWS_AS((sst::cpputils::make_array_bind_first_index<Voice, 500>()),
+                          std::runtime_error);
+        REQUIRE(live == 0);
+
+        {
+            auto voices = sst::cpputils::make_array_bind_first_index<Voice, 300>();
+            REQUIRE(live == 300);
+        }
+        REQUIRE(live == 0);
+    }
+
+    SECTION("Neither Movable Nor Assignable")
+    {
+        auto counters = sst::cpputils::make_array<std::atomic<int>, 300>(3);
+        REQUIRE(counters[0] == 3);
+        REQUIRE(counters[299] == 3);
+
+        struct Locked
+        {
+            size_t idx;
+            std::mutex m;
+            Locked(size_t i) : idx(i) {}
+        };
+        auto locks = sst::cpputils::make_array_bind_first_index<Locked, 300>();
+        REQUIRE(locks[0].idx == 0);
+        REQUIRE(locks[299].idx == 299);
+        auto made = sst::cpputils::make_array_lambda<std::atomic<int>, 300>(
+            [](size_t i) { return (int)i; });
+        REQUIRE(made[123] == 123);
+    }
+
+#if SST_CPPUTILS_HAS_CONSTANT_EVALUATED
+    SECTION("Each Element Built Once")
+    {
+        static int defaults{0}, fromArgs{0};
+        struct Counted
+        {
+            int v{0};
+            Counted() { ++defaults; }
+            Counted(int x) : v(x) { ++fromArgs; }
+            Counted(const Counted &) = default;
+            Counted(Counted &&) = default;
+            Counted &operator=(const Counted &) = default;
+            Counted &operator=(Counted &&) = default;
+        };
+
+        auto same = sst::cpputils::make_array<Counted, 300>(4);
+        auto indexed = sst::cpputils::make_array_bind_first_index<Counted, 300>();
+        auto lambda =
+            sst::cpputils::make_array_lambda<Counted, 300>([](size_t i) { return (int)i * 2; });
+        REQUIRE(defaults == 0);
+        REQUIRE(fromArgs == 900);
+        REQUIRE(same[299].v == 4);
+        REQUIRE(indexed[299].v == 299);
+        REQUIRE(lambda[299].v == 598);
+    }
+#endif
+}
+
+TEST_CASE("Lookup Table")
+{
+    SECTION("Constexpr Table")
+    {
+        static constexpr auto softClip = sst::cpputils::make_table<float, 65>(
+            [](float x) { return x - x * x * x / 3; }, -1.f, 1.f);
+        static_assert(softClip.size() == 65);
+        static_assert(softClip[32] == 0.f);
+        static_assert(softClip.lookup_linear(1.f) == softClip[64]);
+        static_assert(softClip.lookup_linear(-4.f) == softClip[0]);
+        static_assert(softClip.lookup_cubic(0.f) == 0.f);
+
+        // a cubic is reproduced almost exactly by the cubic interpolator away from the edges
+        for (float x = -0.9f; x < 0.9f; x += 0.01f)
+        {
+            REQUIRE(softClip.lookup_cubic(x) == Approx(x - x * x * x / 3).margin(1e-5));
+        }
+    }
+
+    SECTION("Accuracy Against libm")
+    {
+        const float twoPi = 6.283185307179586f;
+        static const auto sine = sst::cpputils::make_table<float, 1024>(
+            [](float x) { return std::sin(x); }, 0.f, twoPi);
+        double linErr{0}, cubErr{0};
+        for (int i = 0; i <= 10000; ++i)
+        {
+            float x = twoPi * i / 10000;
+            linErr = std::max(linErr, (double)std::fabs(sine.lookup_linear(x) - std::sin(x)));
+            cubErr = std::max(cubErr, (double)std::fabs(sine.lookup_cubic(x) - std::sin(x)));
+        }
+        REQUIRE(linErr < 1e-5);
+        REQUIRE(cubErr < 1e-6);
+        REQUIRE(cubErr < linErr);
+
+        auto mtof = sst::cpputils::make_table<double, 128>(
+            [](double n) { return 440.0 * std::pow(2.0, (n - 69) / 12); }, 0.0, 127.0);
+        REQUIRE(mtof.lookup_linear(69.0) == Approx(440.0));
+        REQUIRE(mtof.lookup_cubic(60.5) == Approx(440.0 * std::pow(2.0, -8.5 / 12)).epsilon(1e-4));
+    }
+
+    SECTION("Batch Lookups Match Scalar")
+    {
+        auto tanhTable = sst::cpputils::make_table<float, 512>(
+            [](float x) { return std::tanh(x); }, -4.f, 4.f);
+        auto dbToGain = sst::cpputils::make_table<double, 200>(
+            [](double db) { return std::pow(10.0, db / 20); }, -96.0, 12.0);
+
+        std::mt19937 gen(3);
+        std::uniform_real_distribution<float> dist(-5.f, 5.f);
+        for (size_t n : {0, 1, 7, 8, 9, 31, 1000})
+        {
+            std::vector<float> in(n), lin(n), cub(n);
+            for (auto &x : in)
+                x = dist(gen);
+            if (n > 2)
+            {
+                in[0] = std::numeric_limits<float>::quiet_NaN();
+                in[1] = std::numeric_limits<float>::infinity();
+            }
+            tanhTable.lookup_linear(in.data(), lin.data(), n);
+            tanhTable.lookup_cubic(in.data(), cub.data(), n);
+            for (size_t k = 0; k < n; ++k)
+            {
+                REQUIRE(lin[k] == Approx(tanhTable.lookup_linear(in[k])).margin(1e-6));
+                REQUIRE(cub[k] == Approx(tanhTable.lookup_cubic(in[k])).margin(1e-6));
+            }
+            if (n > 2)
+            {
+                REQUIRE(lin[0] == tanhTable[0]);
+                REQUIRE(lin[1] == tanhTable[511]);
+            }
+
+            std::vector<double> din(n), dout(n);
+            for (size_t k = 0; k < n; ++k)
+                din[k] = dist(gen) * 20;
+            dbToGain.lookup_cubic(din.data(), dout.data(), n);
+            for (size_t k = 0; k < n; ++k)
+                REQUIRE(dout[k] == dbToGain.lookup_cubic(din[k]));
+        }
+    }
+}
+
+TEST_CASE("Parallel Array CTor")
+{
+    static std::atomic<int> live{0};
+    struct Voice
+    {
+        size_t index;
+        std::vector<float> wavetable;
+
+        Voice(size_t i, float sampleRate) : index(i), wavetable(2048)
+        {
+            if (sampleRate <= 0)
+                throw std::invalid_argument("bad sample rate");
+            for (size_t k = 0; k < wavetable.size(); ++k)
+                wavetable[k] = std::sin((float)(k * (i + 1)) / sampleRate);
+            ++live;
+        }
+        Voice(Voice &&o) noexcept : index(o.index), wavetable(std::move(o.wavetable)) { ++live; }
+        Voice(const Voice &) = delete;
+        ~Voice() { --live; }
+    };
+
+    sst::cpputils::ThreadPool pool(3);
+
+    SECTION("Array")
+    {
+        {
+            auto voices = sst::cpputils::make_array_parallel<Voice, 64>(
+                [](size_t i) { return Voice(i, 48000.f); }, pool);
+            REQUIRE(live == 64);
+            for (size_t i = 0; i < voices.size(); ++i)
+            {
+                REQUIRE(voices[i].index == i);
+                REQUIRE(voices[i].wavetable[1] == std::sin((float)(i + 1) / 48000.f));
+            }
+        }
+        REQUIRE(live == 0);
+    }
+
+    SECTION("Vector")
+    {
+        {
+            auto voices = sst::cpputils::make_vector_parallel<Voice>(
+                300, [](size_t i) { return Voice(i, 44100.f); }, pool);
+            REQUIRE(voices.size() == 300);
+            REQUIRE(live == 300);
+            for (size_t i = 0; i < voices.size(); ++i)
+                REQUIRE(voices[i].index == i);
+        }
+        REQUIRE(live == 0);
+
+        auto none = sst::cpputils::make_vector_parallel<Voice>(
+            0, [](size_t i) { return Voice(i, 1.f); }, pool);
+        REQUIRE(none.empty());
+    }
+
+    SECTION("Partial Failure")
+    {
+        auto failAt37 = [](size_t i) { return Voice(i, i == 37 ? -1.f : 48000.f); };
+        REQUIRE_THROWS_AS((sst::cpputils::make_array_parallel<Voice, 64>(failAt37, pool)),
+                          std::invalid_argument);
+        REQUIRE(live == 0);
+        REQUIRE_THROWS_AS(sst::cpputils::make_vector_parallel<Voice>(100, failAt37, pool),
+                          std::invalid_argument);
+        REQUIRE(live == 0);
+    }
+
+    SECTION("Over Aligned")
+    {
+        struct alignas(64) Block
+        {
+            float v[16];
+            explicit Block(size_t i) { v[0] = (float)i; }
+        };
+        auto blocks = sst::cpputils::make_vector_parallel<Block>(
+            33, [](size_t i) { return Block(i); }, pool);
+        auto arr = sst::cpputils::make_array_parallel<Block, 33>(
+            [](size_t i) { return Block(i); });
+        for (size_t i = 0; i < 33; ++i)
+        {
+            REQUIRE(blocks[i].v[0] == (float)i);
+            REQUIRE(arr[i].v[0] == (float)i);
+            REQUIRE(reinterpret_cast<uintptr_t>(&blocks[i]) % 64 == 0);
+        }
+    }
+}
+
+namespace constexpr_tables
+{
+struct Biquad
+{
+    double b0, b1;
+    constexpr Biquad(double g, int stage) : b0(g / (stage + 1)), b1(-g / (stage + 2)) {}
+    constexpr double sum() const { return b0 + b1; }
+    constexpr double scaled(double by) const { return b0 * by; }
+};
+
+constexpr int square(int x) { return x * x; }
+constexpr double ramp(double slope, size_t i) { return slope * (double)i; }
+
+// Namespace scope constexpr tables: these are constant-initialized, never static-initialized
+constexpr auto squares = sst::cpputils::make_array_lambda<int, 16>(
+    sst::cpputils::bind_front([](int offset, size_t i) { return square((int)i) + offset; }, 1));
+constexpr auto stages = sst::cpputils::make_array_bind_last_index<Biquad, 4>(2.0);
+constexpr auto rampTable = sst::cpputils::make_array_lambda<double, 8>(
+    sst::cpputils::bind_front<&ramp>(0.5));
+} // namespace constexpr_tables
+
+TEST_CASE("Constexpr Tables")
+{
+    using namespace constexpr_tables;
+
+    SECTION("Binders")
+    {
+        constexpr auto plusTen = sst::cpputils::bind_front([](int a, int b) { return a + b; }, 10);
+        static_assert(plusTen(5) == 15);
+        static_assert(std::move(plusTen)(1) == 11);
+
+        constexpr auto minus = sst::cpputils::bind_back([](int a, int b) { return a - b; }, 3);
+        static_assert(minus(10) == 7);
+
+        constexpr Biquad bq{1.0, 0};
+        constexpr auto viaMember = sst::cpputils::bind_front(&Biquad::scaled, bq);
+        static_assert(viaMember(4.0) == 4.0);
+        constexpr auto viaPointer = sst::cpputils::bind_back(&Biquad::scaled, 2.0);
+        static_assert(viaPointer(&bq) == 2.0);
+        constexpr auto dataMember = sst::cpputils::bind_front(&Biquad::b0);
+        static_assert(dataMember(bq) == 1.0);
+        static_assert(sst::cpputils::bind_front<&Biquad::sum>(bq)() == 0.5);
+    }
+
+    SECTION("Arrays")
+    {
+        static_assert(squares[0] == 1);
+        static_assert(squares[15] == 226);
+        static_assert(rampTable[7] == 3.5);
+        static_assert(stages[0].b0 == 2.0);
+        static_assert(stages[3].b1 == -2.0 / 5);
+
+        constexpr auto same = sst::cpputils::make_array<Biquad, 3>(4.0, 1);
+        static_assert(same[2].b0 == 2.0);
+        constexpr auto first =
+            sst::cpputils::make_array_bind_first_index<std::pair<int, int>, 4>(9);
+        static_assert(first[3].first == 3 && first[3].second == 9);
+
+        for (size_t i = 0; i < squares.size(); ++i)
+            REQUIRE(squares[i] == (int)(i * i) + 1);
+    }
+}
+
+namespace md_tables
+{
+struct Band
+{
+    size_t voice, band;
+    Band(size_t v, size_t b) : voice(v), band(b) {}
+};
+
+constexpr auto grid3 = sst::cpputils::make_array_nd<int, 2, 3, 4>(
+    [](size_t i, size_t j, size_t k) { return (int)(i * 100 + j * 10 + k); });
+} // namespace md_tables
+
+TEST_CASE("Multi Dimensional Array")
+{
+    using namespace md_tables;
+
+    SECTION("Layout And Indexing")
+    {
+        using md_t = sst::cpputils::mdarray<int, 2, 3, 4>;
+        static_assert(md_t::rank == 3 && md_t::size() == 24);
+        static_assert(md_t::extent(1) == 3 && md_t::stride(0) == 12 && md_t::stride(2) == 1);
+        static_assert(md_t::flat_index({1, 2, 3}) == 23);
+        static_assert(md_t::unravel(17)[0] == 1 && md_t::unravel(17)[1] == 1 &&
+                      md_t::unravel(17)[2] == 1);
+        static_assert(grid3(1, 2, 3) == 123);
+        static_assert(grid3[{0, 1, 2}] == 12);
+        static_assert(sizeof(grid3) == sizeof(int) * 24);
+
+        for (size_t f = 0; f < md_t::size(); ++f)
+            REQUIRE(md_t::flat_index(md_t::unravel(f)) == f);
+
+        // storage is row major and contiguous
+        int expected{0};
+        for (auto v : grid3)
+        {
+            REQUIRE(v == grid3[md_t::unravel((size_t)expected)]);
+            ++expected;
+        }
+        REQUIRE(grid3.data()[5] == 11);
+    }
+
+    SECTION("Non Default Constructible")
+    {
+        auto grid = sst::cpputils::make_array_nd<Band, 8, 16>(
+            [](size_t v, size_t b) { return Band(v, b); });
+        for (size_t v = 0; v < 8; ++v)
+            for (size_t b = 0; b < 16; ++b)
+            {
+                REQUIRE(grid(v, b).voice == v);
+                REQUIRE(grid(v, b).band == b);
+            }
+
+        // Past the pack limit, through the loop path
+        auto big = sst::cpputils::make_array_nd<Band, 32, 64>(
+            [](size_t v, size_t b) { return Band(v, b); });
+        REQUIRE(big(31, 63).voice == 31);
+        REQUIRE(big(17, 5).band == 5);
+    }
+
+    SECTION("Rows Columns And Lines")
+    {
+        auto grid = sst::cpputils::make_array_nd<int, 4, 5>(
+            [](size_t r, size_t c) { return (int)(r * 10 + c); });
+
+        for (auto [c, v] : sst::cpputils::enumerate(grid.row(2)))
+            REQUIRE(v == (int)(20 + c));
+        REQUIRE(grid.row_data(3) == &grid(3, 0));
+        REQUIRE(grid.row_data(3) + 4 == &grid(3, 4));
+
+        for (auto [r, v] : sst::cpputils::enumerate(grid.column(3)))
+            REQUIRE(v == (int)(r * 10 + 3));
+        REQUIRE(grid.column(3).size() == 4);
+
+        for (auto &v : grid.column(1))
+            v = -1;
+        for (size_t r = 0; r < 4; ++r)
+            REQUIRE(grid(r, 1) == -1);
+
+        const auto &cgrid = grid;
+        int rowSum{0};
+        for (const auto &[a, b] : sst::cpputils::zip(cgrid.row(0), cgrid.row(1)))
+            rowSum += b - a;
+        REQUIRE(rowSum == 40);
+
+        auto depth = grid3.line<2>({1, 2, 0});
+        REQUIRE(depth.size() == 4);
+        REQUIRE(depth[3] == 123);
+        auto across = grid3.line<0>({0, 1, 3});
+        REQUIRE(across.size() == 2);
+        REQUIRE(across[0] == 13);
+        REQUIRE(across[1] == 113);
+        auto row = grid3.row(1, 1);
+        REQUIRE(std::accumulate(row.begin(), row.end(), 0) == 4 * 110 + 6);
+    }
+}
+
 int main(int argc, char **argv)
 {
     int result = Catch::Session().run(argc, argv);